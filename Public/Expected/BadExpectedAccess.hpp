@@ -1,8 +1,13 @@
 #pragma once
 
+#include <atomic>
+#include <cstdlib>
 #include <exception>
+#include <type_traits>
 #include <utility>
 
+#include <Expected/Config.hpp>
+
 namespace stdx {
     template <typename E>
     class BadExpectedAccess;
@@ -29,4 +34,38 @@ namespace stdx {
     private:
         E Value;
     };
-}
\ No newline at end of file
+
+    using BadExpectedAccessHandler = void (*)();
+}
+
+namespace stdx::details {
+    inline std::atomic<BadExpectedAccessHandler> GlobalBadExpectedAccessHandler = nullptr;
+
+    [[noreturn]] inline void DefaultBadExpectedAccessHandler() noexcept {
+        if (BadExpectedAccessHandler Handler = GlobalBadExpectedAccessHandler.load(std::memory_order_acquire)) {
+            Handler();
+        }
+        std::abort();
+    }
+
+    // Out of line and cold, so that Value() only costs its callers a test and a call: the copy of the error into the
+    // exception and the throw itself are emitted once per error type.
+    template <typename E>
+    [[noreturn]] _EXPECTED_COLD void ThrowBadExpectedAccess(E&& Error) {
+#if defined(STDX_EXPECTED_NO_EXCEPTIONS)
+        static_cast<void>(Error);
+        STDX_EXPECTED_BAD_ACCESS_HANDLER();
+        std::abort();
+#else
+        throw BadExpectedAccess<std::decay_t<E>>(std::forward<E>(Error));
+#endif
+    }
+}
+
+namespace stdx {
+    // Installs a hook called by the default STDX_EXPECTED_BAD_ACCESS_HANDLER before the process is aborted, e.g. to
+    // flush logs. Only consulted when exceptions are disabled. Returns the previously installed hook.
+    inline BadExpectedAccessHandler SetBadExpectedAccessHandler(BadExpectedAccessHandler Handler) noexcept {
+        return details::GlobalBadExpectedAccessHandler.exchange(Handler, std::memory_order_acq_rel);
+    }
+}
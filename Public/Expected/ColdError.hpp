@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <Expected/Config.hpp>
+#include <Expected/NicheTraits.hpp>
+#include <Expected/RelocationTraits.hpp>
+
+namespace stdx::details {
+    /*
+     * Blocks of one size and alignment, kept on a free list per thread once released so that a burst of errors does not
+     * go to the global allocator for each one. A block may be released on another thread than the one it came from; it
+     * then simply joins the list of that thread. Blocks allocated or released once the list of a thread is gone, by a
+     * ColdError with static storage duration or by a later thread_local destructor, go to the global allocator.
+     */
+    template <std::size_t Size, std::size_t Alignment>
+    class ColdBlockPool {
+        struct FreeBlock {
+            FreeBlock* Next;
+        };
+
+        static constexpr std::size_t BlockSize = Size < sizeof(FreeBlock) ? sizeof(FreeBlock) : Size;
+        static constexpr std::size_t BlockAlignment = Alignment < alignof(FreeBlock) ? alignof(FreeBlock) : Alignment;
+
+        // Enough for a burst, small enough not to hoard memory once it has passed.
+        static constexpr std::size_t MaxCached = 64;
+
+        struct Cache {
+            Cache() = default;
+            Cache(const Cache&) = delete;
+            Cache& operator=(const Cache&) = delete;
+
+            ~Cache() {
+                while (Head) {
+                    ::operator delete(static_cast<void*>(std::exchange(Head, Head->Next)), std::align_val_t(BlockAlignment));
+                }
+                Count = 0;
+                bTornDown = true;
+            }
+
+            FreeBlock* Head = nullptr;
+            std::size_t Count = 0;
+        };
+
+        // Trivially destructible, so it can still be read once the cache of the thread has been destroyed.
+        static inline thread_local bool bTornDown = false;
+
+        // The cache of the calling thread, or nullptr once it has been destroyed.
+        static Cache* Local() noexcept {
+            if (_EXPECTED_UNLIKELY(bTornDown)) {
+                return nullptr;
+            }
+            thread_local Cache Instance;
+            return &Instance;
+        }
+
+    public:
+        static void* Allocate() {
+            Cache* Blocks = Local();
+            if (Blocks != nullptr && Blocks->Head) {
+                --Blocks->Count;
+                return std::exchange(Blocks->Head, Blocks->Head->Next);
+            }
+            return ::operator new(BlockSize, std::align_val_t(BlockAlignment));
+        }
+
+        static void Deallocate(void* Block) noexcept {
+            Cache* Blocks = Local();
+            if (Blocks == nullptr || Blocks->Count == MaxCached) {
+                ::operator delete(Block, std::align_val_t(BlockAlignment));
+                return;
+            }
+            ++Blocks->Count;
+            Blocks->Head = ::new (Block) FreeBlock{Blocks->Head};
+        }
+    };
+}
+
+namespace stdx {
+    /*
+     * An error kept out of line: ColdError<E> holds a pointer to an E in a pooled block, so that Expected<T, ColdError<E>>
+     * is about as large as T plus a pointer however large E is. Suited to rich diagnostics on paths that rarely fail,
+     * where an inline E would widen every return slot and every array of results for the sake of the few errors.
+     *
+     * It has the value semantics of E: copies copy the boxed error, comparisons compare it. A moved-from ColdError holds
+     * nothing: it must not be dereferenced, its copies hold nothing either, and it equals only another empty one.
+     */
+    template <typename E>
+    class ColdError {
+        static_assert(std::is_object_v<E> && !std::is_array_v<E>, "ColdError boxes an object type");
+
+        using Pool = details::ColdBlockPool<sizeof(E), alignof(E)>;
+
+    public:
+        using ErrorType = E;
+
+        template <
+            typename G = E,
+            typename std::enable_if_t<
+                std::conjunction_v<
+                    std::negation<std::is_same<std::remove_cv_t<std::remove_reference_t<G>>, ColdError>>,
+                    std::negation<std::is_same<std::remove_cv_t<std::remove_reference_t<G>>, std::in_place_t>>,
+                    std::is_constructible<E, G>>,
+                int> = 0>
+        ColdError(G&& Error) : Box(Make(std::forward<G>(Error))) {}
+
+        template <typename... Ts, typename std::enable_if_t<std::is_constructible_v<E, Ts...>, int> = 0>
+        explicit ColdError(std::in_place_t, Ts&&... Args) : Box(Make(std::forward<Ts>(Args)...)) {}
+
+        ColdError(const ColdError& Other) : Box(Other.Box != nullptr ? Make(*Other.Box) : nullptr) {}
+
+        ColdError(ColdError&& Other) noexcept : Box(std::exchange(Other.Box, nullptr)) {}
+
+        ColdError& operator=(const ColdError& Other) {
+            ColdError Copy(Other);
+            std::swap(Box, Copy.Box);
+            return *this;
+        }
+
+        ColdError& operator=(ColdError&& Other) noexcept {
+            std::swap(Box, Other.Box);
+            return *this;
+        }
+
+        ~ColdError() {
+            if (Box) {
+                Box->~E();
+                Pool::Deallocate(Box);
+            }
+        }
+
+        [[nodiscard]] const E& operator*() const noexcept {
+            return *Box;
+        }
+
+        [[nodiscard]] E& operator*() noexcept {
+            return *Box;
+        }
+
+        [[nodiscard]] const E* operator->() const noexcept {
+            return Box;
+        }
+
+        [[nodiscard]] E* operator->() noexcept {
+            return Box;
+        }
+
+        [[nodiscard]] friend bool operator==(const ColdError& X, const ColdError& Y) {
+            if (X.Box == nullptr || Y.Box == nullptr) {
+                return X.Box == Y.Box;
+            }
+            return *X.Box == *Y.Box;
+        }
+
+        [[nodiscard]] friend bool operator!=(const ColdError& X, const ColdError& Y) {
+            return !(X == Y);
+        }
+
+    private:
+        template <typename... Ts>
+        static E* Make(Ts&&... Args) {
+            void* const Block = Pool::Allocate();
+            _EXPECTED_TRY {
+                return ::new (Block) E(std::forward<Ts>(Args)...);
+            }
+            _EXPECTED_CATCH_ALL {
+                Pool::Deallocate(Block);
+                _EXPECTED_RETHROW;
+            }
+        }
+
+        E* Box;
+    };
+
+    // The box is a pointer to memory the error owns elsewhere.
+    template <typename E>
+    struct IsTriviallyRelocatable<ColdError<E>> : std::true_type {};
+
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_WIN32)
+    // Pool blocks are at least pointer-aligned, so the lowest bit of the box pointer is always clear. Setting it marks
+    // the error as absent, which makes Expected<void, ColdError<E>> a single pointer.
+    template <typename E>
+    struct NicheTraits<ColdError<E>> {
+        static constexpr std::size_t Offset = 0;
+        static constexpr unsigned char Value = 0x01;
+    };
+#endif
+}
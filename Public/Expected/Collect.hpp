@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::details {
+    template <typename Range>
+    using RangeIterator = decltype(std::begin(std::declval<Range&>()));
+
+    template <typename Range>
+    using RangeReference = decltype(*std::declval<RangeIterator<Range>>());
+
+    // An element is copied out only when both the range and the element are lvalues, and moved out otherwise.
+    template <typename Range>
+    using MovesElements = Not<And<IsLvalueReference<Range>, IsLvalueReference<RangeReference<Range>>>>;
+
+    template <typename Range, typename X>
+    constexpr decltype(auto) ForwardElement(X&& Element) noexcept {
+        if constexpr (MovesElements<Range>()) {
+            return std::move(Element);
+        } else {
+            return static_cast<X&&>(Element);
+        }
+    }
+
+    // What collecting Expected<T, E> results gives: every value, in order, or nothing at all for Expected<void, E>.
+    template <typename T, typename E>
+    using CollectResult = Expected<Conditional<IsVoid<T>, void, std::vector<std::remove_cv_t<T>>>, E>;
+
+    template <std::size_t Index, typename Tuple>
+    using TupleElement = std::tuple_element_t<Index, RemoveCVRef<Tuple>>;
+
+    template <typename ResultType, std::size_t Index, typename Tuple>
+    constexpr ResultType FirstErrorOf(Tuple&& Results) {
+        if constexpr (Index + 1 < std::tuple_size_v<RemoveCVRef<Tuple>>) {
+            if (std::get<Index>(Results).HasValue()) {
+                return FirstErrorOf<ResultType, Index + 1>(std::forward<Tuple>(Results));
+            }
+        }
+        return ResultType(untracked, std::get<Index>(std::forward<Tuple>(Results)).Error());
+    }
+
+    template <typename Tuple, std::size_t... Indices>
+    constexpr auto SequenceTuple(Tuple&& Results, std::index_sequence<Indices...>) {
+        static_assert(
+            And<IsExpectedSpecialization<RemoveCVRef<TupleElement<Indices, Tuple>>>...>(),
+            "Sequence requires a tuple of Expected");
+
+        using E = ErrorTypeOf<TupleElement<0, Tuple>>;
+        using ResultType = Expected<std::tuple<std::remove_cv_t<ValueTypeOf<TupleElement<Indices, Tuple>>>...>, E>;
+        static_assert(
+            And<Same<ErrorTypeOf<TupleElement<Indices, Tuple>>, E>...>(), "Sequence requires the same error type throughout");
+        static_assert(
+            !Or<IsVoid<ValueTypeOf<TupleElement<Indices, Tuple>>>...>(), "Sequence of Expected<void, E> is not supported");
+
+        if ((std::get<Indices>(Results).HasValue() && ...)) {
+            return ResultType(std::in_place, *std::get<Indices>(std::forward<Tuple>(Results))...);
+        }
+        return FirstErrorOf<ResultType, 0>(std::forward<Tuple>(Results));
+    }
+}
+
+namespace stdx {
+    /*
+     * Turns a range of Expected<T, E> into an Expected<std::vector<T>, E> holding every value in order, or the first
+     * error of the range. Values and the error are moved out of an rvalue range and copied out of an lvalue one. A range
+     * of Expected<void, E> collects into an Expected<void, E>.
+     *
+     * Ranges that can be traversed twice are first scanned for an error, so that failing costs no allocation and
+     * succeeding allocates the vector once, at its final size.
+     */
+    template <typename Range>
+    auto Collect(Range&& Results) {
+        using X = details::RemoveCVRef<details::RangeReference<Range>>;
+        static_assert(details::IsExpectedSpecialization<X>(), "Collect requires a range of Expected");
+        static_assert(!std::is_reference_v<typename X::ValueType>, "Collect of Expected<T&, E> is not supported");
+
+        using T = typename X::ValueType;
+        using ResultType = details::CollectResult<T, typename X::ErrorType>;
+        using Category = typename std::iterator_traits<details::RangeIterator<Range>>::iterator_category;
+
+        auto First = std::begin(Results);
+        const auto Last = std::end(Results);
+        if constexpr (details::IsVoid<T>() || std::is_base_of_v<std::forward_iterator_tag, Category>) {
+            for (auto It = First; It != Last; ++It) {
+                if (_EXPECTED_UNLIKELY(!(*It).HasValue())) {
+                    return ResultType(details::untracked, details::ForwardElement<Range>(*It).Error());
+                }
+            }
+            if constexpr (details::IsVoid<T>()) {
+                return ResultType();
+            } else {
+                std::vector<std::remove_cv_t<T>> Values;
+                Values.reserve(std::size_t(std::distance(First, Last)));
+                for (; First != Last; ++First) {
+                    Values.emplace_back(*details::ForwardElement<Range>(*First));
+                }
+                return ResultType(std::in_place, std::move(Values));
+            }
+        } else {
+            std::vector<std::remove_cv_t<T>> Values;
+            for (; First != Last; ++First) {
+                auto&& Result = *First;
+                if (_EXPECTED_UNLIKELY(!Result.HasValue())) {
+                    return ResultType(details::untracked, details::ForwardElement<Range>(Result).Error());
+                }
+                Values.emplace_back(*details::ForwardElement<Range>(Result));
+            }
+            return ResultType(std::in_place, std::move(Values));
+        }
+    }
+
+    /*
+     * Turns a tuple of Expected<Ts, E>..., or anything std::get and std::tuple_size work on such as a std::pair or a
+     * std::array, into an Expected<std::tuple<Ts...>, E> holding every value, or the first error in tuple order. The
+     * results are moved out of an rvalue tuple; std::forward_as_tuple(X, Y) sequences X and Y without copying them into
+     * a tuple first.
+     */
+    template <typename Tuple>
+    constexpr auto Sequence(Tuple&& Results) {
+        constexpr std::size_t Size = std::tuple_size_v<details::RemoveCVRef<Tuple>>;
+        static_assert(Size > 0, "Sequence requires at least one Expected");
+        return details::SequenceTuple(std::forward<Tuple>(Results), std::make_index_sequence<Size>());
+    }
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+// Exception-free mode is entered automatically when the translation unit is compiled without exception support
+// (-fno-exceptions, /EHs-c-). In this mode the strong exception guarantee machinery (backup copies, rollback blocks) is
+// compiled out and accessing the value of an Expected holding an error reports through STDX_EXPECTED_BAD_ACCESS_HANDLER
+// instead of throwing. It cannot be forced on while exceptions are enabled: constructors could still throw half-way
+// through the paths that rely on nothing unwinding, and leave a destroyed alternative flagged as live.
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#if defined(STDX_EXPECTED_NO_EXCEPTIONS)
+#error "STDX_EXPECTED_NO_EXCEPTIONS requires compiling without exception support (-fno-exceptions, /EHs-c-)"
+#endif
+#elif !defined(STDX_EXPECTED_NO_EXCEPTIONS)
+#define STDX_EXPECTED_NO_EXCEPTIONS
+#endif
+
+#if defined(STDX_EXPECTED_NO_EXCEPTIONS)
+#define _EXPECTED_TRY if constexpr (true)
+#define _EXPECTED_CATCH_ALL else
+#define _EXPECTED_RETHROW static_cast<void>(0)
+#else
+#define _EXPECTED_TRY try
+#define _EXPECTED_CATCH_ALL catch (...)
+#define _EXPECTED_RETHROW throw
+#endif
+
+// Invoked when the value of an Expected holding an error is accessed with exceptions disabled. The handler must
+// not return; the default one calls the hook installed by stdx::SetBadExpectedAccessHandler (if any) and aborts.
+// Define it before including any Expected header to plug in something cheaper, e.g. __builtin_trap().
+#if !defined(STDX_EXPECTED_BAD_ACCESS_HANDLER)
+#define STDX_EXPECTED_BAD_ACCESS_HANDLER() ::stdx::details::DefaultBadExpectedAccessHandler()
+#endif
+
+// Compilers implementing conditionally trivial special members (P0848) advertise them through __cpp_concepts. With
+// them the special members of Expected are declared on one class and selected by constraints, which instantiates far
+// less than the chain of base classes the same rules take otherwise.
+#if defined(__cpp_concepts) && __cpp_concepts >= 202002L
+#define _EXPECTED_CONSTRAINED_SPECIAL_MEMBERS
+#endif
+
+// C++20 lets the lifetime of a union member begin and end during constant evaluation (P0784, P1330), through
+// std::construct_at and a direct destructor call. Where both are available the operations that switch between the
+// value and the error (assignment, Emplace, Swap) are constexpr as well, not only the constructors and observers.
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+
+// _EXPECTED_CONSTEXPR20_EVALUATED() tells such a function whether it is being constant evaluated.
+#if defined(__cpp_constexpr_dynamic_alloc) && defined(__cpp_lib_constexpr_dynamic_alloc)
+#define _EXPECTED_CONSTEXPR20 constexpr
+#define _EXPECTED_CONSTEXPR20_EVALUATED() _EXPECTED_IS_CONSTANT_EVALUATED()
+#else
+#define _EXPECTED_CONSTEXPR20
+#define _EXPECTED_CONSTEXPR20_EVALUATED() false
+#endif
+
+// Lets code that constant evaluation cannot run (error counting, byte copies) step aside for it. Without a way to tell,
+// it is assumed not to be running, and such code has to keep out of constexpr functions altogether.
+#if defined(__cpp_lib_is_constant_evaluated)
+#include <type_traits>
+#define _EXPECTED_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define _EXPECTED_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+
+#if !defined(_EXPECTED_IS_CONSTANT_EVALUATED)
+#define _EXPECTED_IS_CONSTANT_EVALUATED() false
+#endif
+
+// Failure paths (throwing bad access, restoring the previous state when an assignment throws) are kept out of line and
+// in the cold text section, so that the functions using an Expected only carry a call to them. The hints tell the
+// compiler which way the checks guarding them usually go.
+#if defined(__GNUC__) || defined(__clang__)
+#define _EXPECTED_COLD __attribute__((cold, noinline))
+#define _EXPECTED_LIKELY(Condition) __builtin_expect(static_cast<bool>(Condition), 1)
+#define _EXPECTED_UNLIKELY(Condition) __builtin_expect(static_cast<bool>(Condition), 0)
+#elif defined(_MSC_VER)
+#define _EXPECTED_COLD __declspec(noinline)
+#define _EXPECTED_LIKELY(Condition) static_cast<bool>(Condition)
+#define _EXPECTED_UNLIKELY(Condition) static_cast<bool>(Condition)
+#else
+#define _EXPECTED_COLD
+#define _EXPECTED_LIKELY(Condition) static_cast<bool>(Condition)
+#define _EXPECTED_UNLIKELY(Condition) static_cast<bool>(Condition)
+#endif
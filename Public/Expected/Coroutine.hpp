@@ -0,0 +1,337 @@
+#pragma once
+
+#include <Expected/Expected.hpp>
+
+// The result of a coroutine is stored in the object get_return_object hands out, which has to be converted to the
+// Expected the caller gets only once the body has run. The standard leaves that timing open; Clang before 17 may convert
+// right away (llvm-project issue 56532), so coroutine support is left out there instead of failing at run time.
+#if defined(__clang__) && defined(__apple_build_version__)
+#define _EXPECTED_EAGER_RETURN_OBJECT (__clang_major__ < 16)
+#elif defined(__clang__)
+#define _EXPECTED_EAGER_RETURN_OBJECT (__clang_major__ < 17)
+#else
+#define _EXPECTED_EAGER_RETURN_OBJECT 0
+#endif
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>) && !_EXPECTED_EAGER_RETURN_OBJECT
+#include <coroutine>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+#define STDX_EXPECTED_HAS_COROUTINES
+
+#if !defined(STDX_EXPECTED_FRAME_STACK_SIZE)
+#define STDX_EXPECTED_FRAME_STACK_SIZE 16384
+#endif
+
+namespace stdx {
+    /*
+     * Stack of coroutine frames carved out of a caller-supplied buffer.
+     *
+     * A coroutine returning Expected never suspends: it either runs to completion or stops at the first co_await of an
+     * error. Frames are therefore released in the reverse order of their allocation, and a bump pointer is all the
+     * bookkeeping needed. Frames that do not fit fall back to the global operator new.
+     *
+     * Pass an arena as std::allocator_arg, Arena as the leading parameters of a coroutine to allocate its frame there.
+     * Coroutines without one use a per-thread stack of STDX_EXPECTED_FRAME_STACK_SIZE bytes.
+     */
+    class CoroutineArena {
+    public:
+        static constexpr std::size_t Alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+        constexpr CoroutineArena() noexcept = default;
+
+        // Frames are handed out at Alignment, so the bytes of Buffer before its first aligned address go unused.
+        CoroutineArena(void* Buffer, std::size_t Capacity) noexcept {
+            if (std::align(Alignment, 0, Buffer, Capacity) == nullptr) {
+                Capacity = 0;
+            }
+            Begin = static_cast<unsigned char*>(Buffer);
+            Top = Begin;
+            End = Begin + Capacity;
+        }
+
+        CoroutineArena(const CoroutineArena&) = delete;
+
+        CoroutineArena& operator=(const CoroutineArena&) = delete;
+
+        [[nodiscard]] void* Allocate(std::size_t Size) noexcept {
+            Size = (Size + Alignment - 1) / Alignment * Alignment;
+            if (std::size_t(End - Top) < Size) {
+                return nullptr;
+            }
+            void* Frame = Top;
+            Top += Size;
+            return Frame;
+        }
+
+        void Deallocate(void* Frame) noexcept {
+            Top = static_cast<unsigned char*>(Frame);
+        }
+
+        [[nodiscard]] std::size_t Used() const noexcept {
+            return std::size_t(Top - Begin);
+        }
+
+        [[nodiscard]] std::size_t Capacity() const noexcept {
+            return std::size_t(End - Begin);
+        }
+
+    private:
+        unsigned char* Begin = nullptr;
+        unsigned char* Top = nullptr;
+        unsigned char* End = nullptr;
+    };
+}
+
+namespace stdx::details {
+    struct alignas(CoroutineArena::Alignment) FrameStackBuffer {
+        unsigned char Bytes[STDX_EXPECTED_FRAME_STACK_SIZE];
+    };
+
+    // Both are constant-initialized, so touching them costs no thread_local guard.
+    inline thread_local FrameStackBuffer ThreadFrameStackBuffer;
+    inline thread_local CoroutineArena ThreadFrameStack;
+
+    inline CoroutineArena& FrameStack() noexcept {
+        if (ThreadFrameStack.Capacity() == 0) {
+            ::new (&ThreadFrameStack) CoroutineArena(ThreadFrameStackBuffer.Bytes, sizeof(ThreadFrameStackBuffer.Bytes));
+        }
+        return ThreadFrameStack;
+    }
+
+    // Every frame is preceded by the arena it came from, or nullptr when it came from the global operator new.
+    struct alignas(CoroutineArena::Alignment) FrameHeader {
+        CoroutineArena* Arena;
+    };
+
+    inline void* AllocateFrame(std::size_t Size, CoroutineArena& Arena) {
+        CoroutineArena* Owner = &Arena;
+        void* Block = Arena.Allocate(sizeof(FrameHeader) + Size);
+        if (Block == nullptr) {
+            Owner = nullptr;
+            Block = ::operator new(sizeof(FrameHeader) + Size);
+        }
+        return ::new (Block) FrameHeader{Owner} + 1;
+    }
+
+    inline void DeallocateFrame(void* Frame, std::size_t Size) noexcept {
+        FrameHeader* Header = static_cast<FrameHeader*>(Frame) - 1;
+        if (Header->Arena != nullptr) {
+            Header->Arena->Deallocate(Header);
+        } else {
+            ::operator delete(Header, sizeof(FrameHeader) + Size);
+        }
+    }
+
+    // Storage for the result of an Expected coroutine, owned by the object get_return_object hands to the caller.
+    // The promise dies with the frame, before the caller converts the return object, so it cannot hold the result.
+    // The body has always run by the time of the conversion on the compilers coroutine support is enabled for.
+    template <typename T, typename E>
+    class CoroutineResult {
+    public:
+        CoroutineResult() noexcept {}
+
+        CoroutineResult(const CoroutineResult&) = delete;
+
+        CoroutineResult& operator=(const CoroutineResult&) = delete;
+
+        ~CoroutineResult() {
+            if (bReady) {
+                Result.~Expected();
+            }
+        }
+
+        template <typename... Ts>
+        void Emplace(Ts&&... Args) noexcept(NothrowConstructible<Expected<T, E>, Ts...>()) {
+            ::new (std::addressof(Result)) Expected<T, E>(std::forward<Ts>(Args)...);
+            bReady = true;
+        }
+
+        [[nodiscard]] Expected<T, E>&& Take() noexcept {
+            return std::move(Result);
+        }
+
+    private:
+        union {
+            Expected<T, E> Result;
+        };
+        bool bReady = false;
+    };
+
+    template <typename T, typename E>
+    class ExpectedReturnObject {
+    public:
+        explicit ExpectedReturnObject(CoroutineResult<T, E>*& Slot) noexcept {
+            Slot = &Result;
+        }
+
+        ExpectedReturnObject(const ExpectedReturnObject&) = delete;
+
+        ExpectedReturnObject& operator=(const ExpectedReturnObject&) = delete;
+
+        operator Expected<T, E>() {
+            return Result.Take();
+        }
+
+    private:
+        CoroutineResult<T, E> Result;
+    };
+
+    template <typename X>
+    class ExpectedAwaiter {
+    public:
+        explicit ExpectedAwaiter(X&& Value) noexcept : Value(std::forward<X>(Value)) {}
+
+        [[nodiscard]] bool await_ready() const noexcept {
+            return Value.HasValue();
+        }
+
+        template <typename Promise>
+        void await_suspend(std::coroutine_handle<Promise> Handle) {
+            Handle.promise().Fail(std::forward<X>(Value).Error());
+            Handle.destroy();
+        }
+
+        decltype(auto) await_resume() {
+            if constexpr (IsVoid<ValueTypeOf<X>>()) {
+                return;
+            } else if constexpr (std::is_lvalue_reference_v<X>) {
+                return *Value;
+            } else {
+                return ValueTypeOf<X>(*std::move(Value));
+            }
+        }
+
+    private:
+        X&& Value;
+    };
+
+    template <typename T, typename E>
+    class BaseExpectedPromise {
+    public:
+        ExpectedReturnObject<T, E> get_return_object() noexcept {
+            return ExpectedReturnObject<T, E>(Result);
+        }
+
+        std::suspend_never initial_suspend() const noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept {
+            return {};
+        }
+
+        void unhandled_exception() const {
+#if defined(STDX_EXPECTED_NO_EXCEPTIONS)
+            std::abort();
+#else
+            throw;
+#endif
+        }
+
+        template <typename U, typename G>
+        ExpectedAwaiter<Expected<U, G>&> await_transform(Expected<U, G>& Value) noexcept {
+            return ExpectedAwaiter<Expected<U, G>&>(Value);
+        }
+
+        template <typename U, typename G>
+        ExpectedAwaiter<const Expected<U, G>&> await_transform(const Expected<U, G>& Value) noexcept {
+            return ExpectedAwaiter<const Expected<U, G>&>(Value);
+        }
+
+        template <typename U, typename G>
+        ExpectedAwaiter<Expected<U, G>&&> await_transform(Expected<U, G>&& Value) noexcept {
+            return ExpectedAwaiter<Expected<U, G>&&>(std::move(Value));
+        }
+
+        template <typename G>
+        void Fail(G&& Error) {
+            Result->Emplace(details::untracked, std::forward<G>(Error));
+        }
+
+    protected:
+        CoroutineResult<T, E>* Result = nullptr;
+    };
+
+    /*
+     * Where the frame of a coroutine taking Ts... goes: the arena passed as its leading std::allocator_arg, Arena, right
+     * after the object for a member function, or the per-thread frame stack. The overloads are picked by the parameter
+     * types rather than deduced, since GCC takes an operator new template to never match the operator delete the frame
+     * is released with.
+     */
+    template <typename... Ts>
+    struct FrameAllocation {
+        static void* operator new(std::size_t Size) {
+            return AllocateFrame(Size, FrameStack());
+        }
+
+        static void operator delete(void* Frame, std::size_t Size) noexcept {
+            DeallocateFrame(Frame, Size);
+        }
+    };
+
+    template <typename... Ts>
+    struct FrameAllocation<std::allocator_arg_t, CoroutineArena&, Ts...> {
+        static void* operator new(std::size_t Size) {
+            return AllocateFrame(Size, FrameStack());
+        }
+
+        static void* operator new(std::size_t Size, std::allocator_arg_t, CoroutineArena& Arena, Ts&...) {
+            return AllocateFrame(Size, Arena);
+        }
+
+        static void operator delete(void* Frame, std::size_t Size) noexcept {
+            DeallocateFrame(Frame, Size);
+        }
+    };
+
+    template <typename Self, typename... Ts>
+    struct FrameAllocation<Self, std::allocator_arg_t, CoroutineArena&, Ts...> {
+        static void* operator new(std::size_t Size) {
+            return AllocateFrame(Size, FrameStack());
+        }
+
+        static void* operator new(std::size_t Size, Self&, std::allocator_arg_t, CoroutineArena& Arena, Ts&...) {
+            return AllocateFrame(Size, Arena);
+        }
+
+        static void operator delete(void* Frame, std::size_t Size) noexcept {
+            DeallocateFrame(Frame, Size);
+        }
+    };
+
+    template <typename T, typename E, typename... Ts>
+    class ExpectedPromise : public BaseExpectedPromise<T, E>, public FrameAllocation<Ts...> {
+    public:
+        template <typename U = T>
+        void return_value(U&& Value) {
+            this->Result->Emplace(std::forward<U>(Value));
+        }
+    };
+
+    template <typename E, typename... Ts>
+    class ExpectedPromise<void, E, Ts...> : public BaseExpectedPromise<void, E>, public FrameAllocation<Ts...> {
+    public:
+        void return_void() noexcept {
+            this->Result->Emplace();
+        }
+    };
+}
+
+/*
+ * Makes every function returning Expected<T, E> usable as a coroutine. Inside one, co_await on an Expected yields its
+ * value, or returns the error from the enclosing function right away:
+ *
+ * stdx::Expected<Config, StatusCode> Load(std::string_view Path) {
+ *     std::string Text = co_await Read(Path);
+ *     co_return co_await Parse(Text);
+ * }
+ */
+template <typename T, typename E, typename... Ts>
+struct std::coroutine_traits<stdx::Expected<T, E>, Ts...> {
+    using promise_type = stdx::details::ExpectedPromise<T, E, Ts...>;
+};
+#endif
@@ -1,39 +1,84 @@
 #pragma once
 
-#include "BaseMoveAssign.hpp"
+#include "ExpectedCombinators.hpp"
+#include "ExpectedSpecialMembers.hpp"
 #include "ExpectedTraits.hpp"
 
 namespace stdx::details {
+#define _EXPECTED_COMBINATOR(Name)                                                                                               \
+    template <typename F>                                                                                                        \
+    constexpr auto Name(F&& Func) & {                                                                                            \
+        return ExpectedCombinators::Name(*this, std::forward<F>(Func));                                                          \
+    }                                                                                                                            \
+                                                                                                                                 \
+    template <typename F>                                                                                                        \
+    constexpr auto Name(F&& Func) const& {                                                                                       \
+        return ExpectedCombinators::Name(*this, std::forward<F>(Func));                                                          \
+    }                                                                                                                            \
+                                                                                                                                 \
+    template <typename F>                                                                                                        \
+    constexpr auto Name(F&& Func) && {                                                                                           \
+        return ExpectedCombinators::Name(std::move(*this), std::forward<F>(Func));                                               \
+    }                                                                                                                            \
+                                                                                                                                 \
+    template <typename F>                                                                                                        \
+    constexpr auto Name(F&& Func) const&& {                                                                                      \
+        return ExpectedCombinators::Name(std::move(*this), std::forward<F>(Func));                                               \
+    }
 
     template <typename T, typename E>
-    class BaseExpected : public BaseMoveAssignment<T, E> {
-        using Super = BaseMoveAssignment<T, E>;
+    class BaseExpected : public ExpectedSpecialMembers<T, E> {
+        using Super = ExpectedSpecialMembers<T, E>;
 
     public:
+        [[nodiscard]] constexpr const T& operator*() const& noexcept {
+            return Super::Data.Value;
+        }
+
+        [[nodiscard]] constexpr T& operator*() & noexcept {
+            return Super::Data.Value;
+        }
+
+        [[nodiscard]] constexpr const T&& operator*() const&& noexcept {
+            return std::move(Super::Data.Value);
+        }
+
+        [[nodiscard]] constexpr T&& operator*() && noexcept {
+            return std::move(Super::Data.Value);
+        }
+
+        [[nodiscard]] constexpr const T* operator->() const noexcept {
+            return std::addressof(**this);
+        }
+
+        [[nodiscard]] constexpr T* operator->() noexcept {
+            return std::addressof(**this);
+        }
+
         constexpr const T& Value() const& {
-            if (!Super::HasValue()) {
-                throw BadExpectedAccess(Super::Error());
+            if (_EXPECTED_UNLIKELY(!Super::HasValue())) {
+                ThrowBadExpectedAccess(Super::Error());
             }
             return **this;
         }
 
         constexpr T& Value() & {
-            if (!Super::HasValue()) {
-                throw BadExpectedAccess(Super::Error());
+            if (_EXPECTED_UNLIKELY(!Super::HasValue())) {
+                ThrowBadExpectedAccess(Super::Error());
             }
             return **this;
         }
 
         constexpr const T&& Value() const&& {
-            if (!Super::HasValue()) {
-                throw BadExpectedAccess(std::move(Super::Error()));
+            if (_EXPECTED_UNLIKELY(!Super::HasValue())) {
+                ThrowBadExpectedAccess(std::move(Super::Error()));
             }
             return std::move(**this);
         }
 
         constexpr T&& Value() && {
-            if (!Super::HasValue()) {
-                throw BadExpectedAccess(std::move(Super::Error()));
+            if (_EXPECTED_UNLIKELY(!Super::HasValue())) {
+                ThrowBadExpectedAccess(std::move(Super::Error()));
             }
             return std::move(**this);
         }
@@ -48,32 +93,102 @@ namespace stdx::details {
             return Super::HasValue() ? std::move(**this) : static_cast<T>(std::forward<U>(Default));
         }
 
+        // Unlike ValueOr, the fallback is only made on error: Factory is called with the error, or with nothing if it
+        // takes no argument.
+        template <typename F>
+        [[nodiscard]] constexpr T ValueOrElse(F&& Factory) const& {
+            if (_EXPECTED_LIKELY(Super::HasValue())) {
+                return **this;
+            }
+            return static_cast<T>(InvokeFallback(std::forward<F>(Factory), Super::Error()));
+        }
+
+        template <typename F>
+        [[nodiscard]] constexpr T ValueOrElse(F&& Factory) && {
+            if (_EXPECTED_LIKELY(Super::HasValue())) {
+                return std::move(**this);
+            }
+            return static_cast<T>(InvokeFallback(std::forward<F>(Factory), std::move(Super::Error())));
+        }
+
+        // Borrowing accessors: the value or a fallback owned by the caller, neither of which is copied. The fallback has
+        // to be an lvalue, and the Expected too, so that the result outlives the call.
+        [[nodiscard]] constexpr const T& ValueOrRef(const T& Fallback) const& noexcept {
+            return Super::HasValue() ? **this : Fallback;
+        }
+
+        [[nodiscard]] constexpr T& ValueOrRef(T& Fallback) & noexcept {
+            return Super::HasValue() ? **this : Fallback;
+        }
+
+        const T& ValueOrRef(const T&&) const& = delete;
+
+        const T& ValueOrRef(const T&) && = delete;
+
+        // The address of the value, or null on error.
+        [[nodiscard]] constexpr const T* ValueIf() const noexcept {
+            return Super::HasValue() ? std::addressof(**this) : nullptr;
+        }
+
+        [[nodiscard]] constexpr T* ValueIf() noexcept {
+            return Super::HasValue() ? std::addressof(**this) : nullptr;
+        }
+
+        // A new value replacing one with a stateful allocator, or an error with one, is built with that allocator, as
+        // assignment does.
         template <typename... Ts>
-        T& Emplace(Ts&&... Args) noexcept(noexcept(std::declval<BaseExpected<T, E>>().DoEmplace(std::forward<Ts>(Args)...))) {
+        _EXPECTED_CONSTEXPR20 T& Emplace(Ts&&... Args) noexcept(
+            noexcept(std::declval<BaseExpected<T, E>>().DoEmplace(std::forward<Ts>(Args)...)) &&
+            !Or<PropagatesAllocator<T, T, Ts...>, PropagatesAllocator<E, T, Ts...>>()) {
+            if constexpr (PropagatesAllocator<T, T, Ts...>()) {
+                if (Super::HasValue()) {
+                    return DoEmplace(MakeUsingAllocator<T>((**this).get_allocator(), std::forward<Ts>(Args)...));
+                }
+            }
+            if constexpr (PropagatesAllocator<E, T, Ts...>()) {
+                if (!Super::HasValue()) {
+                    return DoEmplace(MakeUsingAllocator<T>(Super::Error().get_allocator(), std::forward<Ts>(Args)...));
+                }
+            }
             return DoEmplace(std::forward<Ts>(Args)...);
         }
 
+        // Builds the new value by uses-allocator construction with Alloc.
+        template <
+            typename A,
+            typename... Ts,
+            typename std::enable_if_t<UsesAllocatorConstructible<T, A, Ts...>::value, int> = 0>
+        _EXPECTED_CONSTEXPR20 T& Emplace(std::allocator_arg_t, const A& Alloc, Ts&&... Args) {
+            return DoEmplace(MakeUsingAllocator<T>(Alloc, std::forward<Ts>(Args)...));
+        }
+
         template <typename U, typename... Ts>
-        T& Emplace(std::initializer_list<U> List, Ts&&... Args) noexcept(
+        _EXPECTED_CONSTEXPR20 T& Emplace(std::initializer_list<U> List, Ts&&... Args) noexcept(
             noexcept(std::declval<BaseExpected<T, E>>().DoEmplace(List, std::forward<Ts>(Args)...))) {
             return DoEmplace(List, std::forward<Ts>(Args)...);
         }
 
+        _EXPECTED_COMBINATOR(AndThen)
+        _EXPECTED_COMBINATOR(Transform)
+        _EXPECTED_COMBINATOR(OrElse)
+        _EXPECTED_COMBINATOR(TransformError)
+
     protected:
         using Super::Super;
 
     private:
         template <typename... Ts, typename std::enable_if_t<EmplacebleFromTs<T, E, Ts...>::value, int> = 0>
-        T& DoEmplace(Ts&&... Args) noexcept(NothrowConstructible<T, Ts...>()) {
+        _EXPECTED_CONSTEXPR20 T& DoEmplace(Ts&&... Args) noexcept(NothrowConstructible<T, Ts...>()) {
             if (Super::HasValue()) {
-                if constexpr (NothrowConstructible<T, Ts...>()) {
+                if constexpr (NothrowOrNoExceptions<NothrowConstructible<T, Ts...>>()) {
                     Super::DestroyValue();
                     Super::ConstructValue(std::forward<Ts>(Args)...);
                 } else {
+                    // The temporary keeps the current value intact if the constructor throws.
                     Super::AssignValue(T(std::forward<Ts>(Args)...));
                 }
             } else {
-                if constexpr (NothrowConstructible<T, Ts...>()) {
+                if constexpr (NothrowOrNoExceptions<NothrowConstructible<T, Ts...>>()) {
                     Super::DestroyUnexpected();
                     Super::ConstructValue(std::forward<Ts>(Args)...);
                 } else if constexpr (NothrowMoveConstructible<T>()) {
@@ -81,58 +196,150 @@ namespace stdx::details {
                     Super::DestroyUnexpected();
                     Super::ConstructValue(std::move(Tmp));
                 } else {
-                    Unexpected<E> Tmp(std::move(Super::Error()));
+                    E Tmp(std::move(Super::Error()));
                     Super::DestroyUnexpected();
-                    try {
+                    _EXPECTED_TRY {
                         Super::ConstructValue(std::forward<Ts>(Args)...);
-                    } catch (...) {
-                        Super::ConstructUnexpected(std::move(Tmp));
-                        throw;
+                    }
+                    _EXPECTED_CATCH_ALL {
+                        Super::RestoreUnexpected(std::move(Tmp));
+                        _EXPECTED_RETHROW;
                     }
                 }
             }
-            Super::bHasValue = true;
+            Super::SetHasValue(true);
             return **this;
         }
     };
 
-#define _BASE_EXPECTED_VOID(Type)                                                                                                \
+    // A reference is stored as a pointer to its referent, so Expected<T&, E> is laid out exactly like Expected<T*, E>.
+    // Access is shallow like that of a pointer: a const Expected<T&, E> still yields a T&.
+    template <typename T, typename E>
+    class BaseExpected<T&, E> : public ExpectedSpecialMembers<T*, E> {
+        using Super = ExpectedSpecialMembers<T*, E>;
+
+    public:
+        using ValueType = T&;
+
+        [[nodiscard]] constexpr T& operator*() const noexcept {
+            return *Super::Data.Value;
+        }
+
+        [[nodiscard]] constexpr T* operator->() const noexcept {
+            return Super::Data.Value;
+        }
+
+        constexpr T& Value() const& {
+            if (_EXPECTED_UNLIKELY(!Super::HasValue())) {
+                ThrowBadExpectedAccess(Super::Error());
+            }
+            return **this;
+        }
+
+        constexpr T& Value() && {
+            if (_EXPECTED_UNLIKELY(!Super::HasValue())) {
+                ThrowBadExpectedAccess(std::move(Super::Error()));
+            }
+            return **this;
+        }
+
+        // The fallback is not bound to: it is usually a temporary, so the referent is copied out instead.
+        template <typename U>
+        [[nodiscard]] constexpr std::remove_cv_t<T> ValueOr(U&& Default) const {
+            if (Super::HasValue()) {
+                return **this;
+            }
+            return static_cast<std::remove_cv_t<T>>(std::forward<U>(Default));
+        }
+
+        template <typename F>
+        [[nodiscard]] constexpr std::remove_cv_t<T> ValueOrElse(F&& Factory) const& {
+            if (_EXPECTED_LIKELY(Super::HasValue())) {
+                return **this;
+            }
+            return static_cast<std::remove_cv_t<T>>(InvokeFallback(std::forward<F>(Factory), Super::Error()));
+        }
+
+        template <typename F>
+        [[nodiscard]] constexpr std::remove_cv_t<T> ValueOrElse(F&& Factory) && {
+            if (_EXPECTED_LIKELY(Super::HasValue())) {
+                return **this;
+            }
+            return static_cast<std::remove_cv_t<T>>(InvokeFallback(std::forward<F>(Factory), std::move(Super::Error())));
+        }
+
+        // Here the fallback is bound to like the referent, so it is the caller who keeps it alive.
+        [[nodiscard]] constexpr T& ValueOrRef(T& Fallback) const noexcept {
+            return Super::HasValue() ? **this : Fallback;
+        }
+
+        T& ValueOrRef(const T&&) const = delete;
+
+        [[nodiscard]] constexpr T* ValueIf() const noexcept {
+            return Super::HasValue() ? Super::Data.Value : nullptr;
+        }
+
+        template <typename U, typename std::enable_if_t<BindsReference<T, U>::value, int> = 0>
+        _EXPECTED_CONSTEXPR20 T& Emplace(U&& Value) noexcept {
+            if (!Super::HasValue()) {
+                Super::DestroyUnexpected();
+            }
+            Super::ConstructValue(std::addressof(Value));
+            Super::SetHasValue(true);
+            return **this;
+        }
+
+        _EXPECTED_COMBINATOR(AndThen)
+        _EXPECTED_COMBINATOR(Transform)
+        _EXPECTED_COMBINATOR(OrElse)
+        _EXPECTED_COMBINATOR(TransformError)
+
+    protected:
+        using Super::Super;
+    };
+
+#define _BASE_EXPECTED_VOID(Type)                                                                                            \
     template <typename E>                                                                                                        \
-    class BaseExpected<Type, E> : public BaseMoveAssignment<void, E> {                                                           \
-        using Super = BaseMoveAssignment<void, E>;                                                                               \
+    class BaseExpected<Type, E> : public ExpectedSpecialMembers<void, E> {                                                       \
+        using Super = ExpectedSpecialMembers<void, E>;                                                                           \
                                                                                                                                  \
     public:                                                                                                                      \
         constexpr void Value() const& {                                                                                          \
-            if (!Super::HasValue()) {                                                                                            \
-                throw BadExpectedAccess(Super::Error());                                                                         \
+            if (_EXPECTED_UNLIKELY(!Super::HasValue())) {                                                                        \
+                ThrowBadExpectedAccess(Super::Error());                                                                          \
             }                                                                                                                    \
         }                                                                                                                        \
                                                                                                                                  \
         constexpr void Value() & {                                                                                               \
-            if (!Super::HasValue()) {                                                                                            \
-                throw BadExpectedAccess(Super::Error());                                                                         \
+            if (_EXPECTED_UNLIKELY(!Super::HasValue())) {                                                                        \
+                ThrowBadExpectedAccess(Super::Error());                                                                          \
             }                                                                                                                    \
         }                                                                                                                        \
                                                                                                                                  \
         constexpr void Value() const&& {                                                                                         \
-            if (!Super::HasValue()) {                                                                                            \
-                throw BadExpectedAccess(std::move(Super::Error()));                                                              \
+            if (_EXPECTED_UNLIKELY(!Super::HasValue())) {                                                                        \
+                ThrowBadExpectedAccess(std::move(Super::Error()));                                                               \
             }                                                                                                                    \
         }                                                                                                                        \
                                                                                                                                  \
         constexpr void Value() && {                                                                                              \
-            if (!Super::HasValue()) {                                                                                            \
-                throw BadExpectedAccess(std::move(Super::Error()));                                                              \
+            if (_EXPECTED_UNLIKELY(!Super::HasValue())) {                                                                        \
+                ThrowBadExpectedAccess(std::move(Super::Error()));                                                               \
             }                                                                                                                    \
         }                                                                                                                        \
                                                                                                                                  \
-        void Emplace() noexcept {                                                                                                \
+        _EXPECTED_CONSTEXPR20 void Emplace() noexcept {                                                                          \
             if (!Super::HasValue()) {                                                                                            \
                 Super::DestroyUnexpected();                                                                                      \
             }                                                                                                                    \
-            Super::bHasValue = true;                                                                                             \
+            Super::SetHasValue(true);                                                                                            \
         }                                                                                                                        \
                                                                                                                                  \
+        _EXPECTED_COMBINATOR(AndThen)                                                                                            \
+        _EXPECTED_COMBINATOR(Transform)                                                                                          \
+        _EXPECTED_COMBINATOR(OrElse)                                                                                             \
+        _EXPECTED_COMBINATOR(TransformError)                                                                                     \
+                                                                                                                                 \
     protected:                                                                                                                   \
         using Super::Super;                                                                                                      \
     }
@@ -143,4 +350,5 @@ namespace stdx::details {
     _BASE_EXPECTED_VOID(const volatile void);
 
 #undef _BASE_EXPECTED_VOID
+#undef _EXPECTED_COMBINATOR
 }
\ No newline at end of file
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <functional>
+
+#include "Traits.hpp"
+
+namespace stdx::details {
+    template <typename Self>
+    using ValueTypeOf = typename RemoveCVRef<Self>::ValueType;
+
+    template <typename Self>
+    using ErrorTypeOf = typename RemoveCVRef<Self>::ErrorType;
+
+    template <typename Self, typename F>
+    constexpr decltype(auto) InvokeWithValue(Self&& This, F&& Func) {
+        if constexpr (IsVoid<ValueTypeOf<Self>>()) {
+            return std::invoke(std::forward<F>(Func));
+        } else {
+            return std::invoke(std::forward<F>(Func), *std::forward<Self>(This));
+        }
+    }
+
+    // Calls a fallback factory with Arg if it takes it, and with nothing otherwise.
+    template <typename F, typename A>
+    constexpr decltype(auto) InvokeFallback(F&& Factory, A&& Arg) {
+        if constexpr (std::is_invocable_v<F, A>) {
+            return std::invoke(std::forward<F>(Factory), std::forward<A>(Arg));
+        } else {
+            return std::invoke(std::forward<F>(Factory));
+        }
+    }
+
+    template <typename Self, typename F>
+    using ValueInvokeResult = decltype(InvokeWithValue(std::declval<Self>(), std::declval<F>()));
+
+    template <typename Self, typename F>
+    using ErrorInvokeResult = std::invoke_result_t<F, decltype(std::declval<Self>().Error())>;
+
+    /*
+     * Implementation of the AndThen/Transform/OrElse/TransformError members of BaseExpected.
+     * Results are constructed directly in their storage, so neither T nor E passes through a temporary.
+     */
+    struct ExpectedCombinators {
+        template <typename Self, typename F>
+        static constexpr auto AndThen(Self&& This, F&& Func) {
+            using Result = RemoveCVRef<ValueInvokeResult<Self, F>>;
+            static_assert(IsExpectedSpecialization<Result>(), "AndThen requires a callable returning Expected");
+            static_assert(Same<typename Result::ErrorType, ErrorTypeOf<Self>>(), "AndThen can not change the error type");
+
+            if (This.HasValue()) {
+                return Result(InvokeWithValue(std::forward<Self>(This), std::forward<F>(Func)));
+            }
+            return Result(untracked, std::forward<Self>(This).Error());
+        }
+
+        template <typename Self, typename F>
+        static constexpr auto Transform(Self&& This, F&& Func) {
+            using Result = Expected<std::remove_cv_t<ValueInvokeResult<Self, F>>, ErrorTypeOf<Self>>;
+
+            if (This.HasValue()) {
+                if constexpr (IsVoid<ValueTypeOf<Self>>()) {
+                    return Result(in_place_invoke, std::in_place_index<0>, std::forward<F>(Func));
+                } else {
+                    return Result(in_place_invoke, std::in_place_index<0>, std::forward<F>(Func), *std::forward<Self>(This));
+                }
+            }
+            return Result(untracked, std::forward<Self>(This).Error());
+        }
+
+        template <typename Self, typename F>
+        static constexpr auto OrElse(Self&& This, F&& Func) {
+            using Result = RemoveCVRef<ErrorInvokeResult<Self, F>>;
+            static_assert(IsExpectedSpecialization<Result>(), "OrElse requires a callable returning Expected");
+            static_assert(Same<typename Result::ValueType, ValueTypeOf<Self>>(), "OrElse can not change the value type");
+
+            if (This.HasValue()) {
+                if constexpr (IsVoid<ValueTypeOf<Self>>()) {
+                    return Result(std::in_place);
+                } else {
+                    return Result(std::in_place, *std::forward<Self>(This));
+                }
+            }
+            return Result(std::invoke(std::forward<F>(Func), std::forward<Self>(This).Error()));
+        }
+
+        template <typename Self, typename F>
+        static constexpr auto TransformError(Self&& This, F&& Func) {
+            using Result = Expected<ValueTypeOf<Self>, std::remove_cv_t<ErrorInvokeResult<Self, F>>>;
+
+            if (This.HasValue()) {
+                if constexpr (IsVoid<ValueTypeOf<Self>>()) {
+                    return Result(std::in_place);
+                } else {
+                    return Result(std::in_place, *std::forward<Self>(This));
+                }
+            }
+            return Result(in_place_invoke, std::in_place_index<1>, std::forward<F>(Func), std::forward<Self>(This).Error());
+        }
+    };
+}
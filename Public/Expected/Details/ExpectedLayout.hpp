@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+
+#include "BaseExpected.hpp"
+
+namespace stdx::details {
+    // Both the SysV x86-64 and the AArch64 ABIs pass and return trivially copyable objects of up to two machine words
+    // in registers (RAX:RDX, X0:X1) instead of through a hidden pointer to caller-allocated memory.
+    inline constexpr std::size_t RegisterPassableSize = 2 * sizeof(void*);
+
+    template <typename T, typename E>
+    using TriviallyCopyConstructibleAlternatives = And<VoidOrTriviallyCopyConstructible<T>, TriviallyCopyConstructible<E>>;
+
+    template <typename T, typename E>
+    using TriviallyMoveConstructibleAlternatives = And<VoidOrTriviallyMoveConstructible<T>, TriviallyMoveConstructible<E>>;
+
+    // Layout policy: an Expected whose alternatives are trivially copyable, can actually be copied or moved, and whose
+    // payload fits in two machine words is register-passable. Its special members and BaseExpected have to keep it so.
+    template <typename T, typename E>
+    using RegisterPassable = And<
+        VoidOrTriviallyCopyable<T>,
+        TriviallyCopyable<E>,
+        Or<TriviallyCopyConstructibleAlternatives<T, E>, TriviallyMoveConstructibleAlternatives<T, E>>,
+        BoolConstant<(sizeof(ExpectedPayload<T, E>) <= RegisterPassableSize)>>;
+
+    // A layer is trivial when it is trivially copyable and destructible, and its copy and move constructors are trivial
+    // exactly when those of the alternatives are (a deleted one stays deleted).
+    template <typename T, typename E, typename X>
+    using TrivialLayer = And<
+        TriviallyCopyable<X>,
+        TriviallyDestructible<X>,
+        BoolConstant<TriviallyCopyConstructible<X>() == TriviallyCopyConstructibleAlternatives<T, E>()>,
+        BoolConstant<TriviallyMoveConstructible<X>() == TriviallyMoveConstructibleAlternatives<T, E>()>>;
+
+    // Triviality only propagates upwards, so checking the outermost class of the special member layers covers the rest.
+    template <typename T, typename E>
+    using TrivialLayers = And<
+        TrivialLayer<T, E, ExpectedSpecialMembers<T, E>>,
+        TrivialLayer<T, E, BaseExpected<T, E>>,
+        BoolConstant<sizeof(BaseExpected<T, E>) == sizeof(ExpectedPayload<T, E>)>>;
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include <Expected/NicheTraits.hpp>
+
+#include "ExpectedUnion.hpp"
+
+namespace stdx::details {
+    template <typename X, typename = std::void_t<>>
+    struct HasNiche : std::false_type {};
+
+    template <typename X>
+    struct HasNiche<X, std::void_t<decltype(NicheTraits<X>::Offset), decltype(NicheTraits<X>::Value)>> :
+        BoolConstant<(NicheTraits<X>::Offset < sizeof(X))> {};
+
+    enum class ENichePlacement { None, InValue, InError };
+
+    template <typename T, typename E>
+    constexpr ENichePlacement SelectNichePlacement() noexcept {
+        if constexpr (IsVoid<T>()) {
+            return HasNiche<E>() ? ENichePlacement::InError : ENichePlacement::None;
+        } else if constexpr (HasNiche<T>()) {
+            if constexpr (NicheTraits<T>::Offset >= sizeof(Unexpected<E>)) {
+                return ENichePlacement::InValue;
+            } else {
+                return ENichePlacement::None;
+            }
+        } else if constexpr (HasNiche<E>()) {
+            if constexpr (NicheTraits<E>::Offset >= sizeof(T)) {
+                return ENichePlacement::InError;
+            } else {
+                return ENichePlacement::None;
+            }
+        } else {
+            return ENichePlacement::None;
+        }
+    }
+
+    // The discriminant is as wide as the alignment of the union, so it occupies what would otherwise be tail padding.
+    // That keeps sizeof unchanged, but leaves no padding for a base-subobject constructor to skip, which is what lets
+    // GCC keep small trivial specializations such as Expected<int, ErrCode> in registers instead of spilling them.
+    template <std::size_t Alignment>
+    struct SelectDiscriminant {
+        using Type = std::uint64_t;
+    };
+
+    template <>
+    struct SelectDiscriminant<1> {
+        using Type = std::uint8_t;
+    };
+
+    template <>
+    struct SelectDiscriminant<2> {
+        using Type = std::uint16_t;
+    };
+
+    template <>
+    struct SelectDiscriminant<4> {
+        using Type = std::uint32_t;
+    };
+
+    template <typename T, typename E>
+    using Discriminant = typename SelectDiscriminant<alignof(ExpectedUnion<T, E>)>::Type;
+
+    template <typename T, typename E, ENichePlacement = SelectNichePlacement<T, E>()>
+    struct ExpectedPayload {
+        explicit constexpr ExpectedPayload(valueless_t) noexcept : Data(valueless), State(1) {}
+
+        template <typename... Ts>
+        explicit constexpr ExpectedPayload(std::in_place_index_t<0>, Ts&&... Args) noexcept(
+            NothrowConstructible<ExpectedUnion<T, E>, std::in_place_index_t<0>, Ts...>()) :
+            Data(std::in_place_index<0>, std::forward<Ts>(Args)...), State(1) {}
+
+        template <typename... Ts>
+        explicit constexpr ExpectedPayload(std::in_place_index_t<1>, Ts&&... Args) noexcept(
+            NothrowConstructible<ExpectedUnion<T, E>, std::in_place_index_t<1>, Ts...>()) :
+            Data(std::in_place_index<1>, std::forward<Ts>(Args)...), State(0) {}
+
+        [[nodiscard]] constexpr bool LoadHasValue() const noexcept {
+            return State != 0;
+        }
+
+        constexpr void StoreHasValue(bool bValue) noexcept {
+            State = Discriminant<T, E>(bValue);
+        }
+
+        ExpectedUnion<T, E> Data;
+        Discriminant<T, E> State;
+    };
+
+    template <typename T, typename E>
+    struct ExpectedPayload<T, E, ENichePlacement::InValue> {
+        explicit constexpr ExpectedPayload(valueless_t) noexcept : Data(valueless) {}
+
+        template <typename... Ts>
+        explicit constexpr ExpectedPayload(std::in_place_index_t<0>, Ts&&... Args) noexcept(
+            NothrowConstructible<ExpectedUnion<T, E>, std::in_place_index_t<0>, Ts...>()) :
+            Data(std::in_place_index<0>, std::forward<Ts>(Args)...) {}
+
+        template <typename... Ts>
+        explicit ExpectedPayload(std::in_place_index_t<1>, Ts&&... Args) noexcept(
+            NothrowConstructible<ExpectedUnion<T, E>, std::in_place_index_t<1>, Ts...>()) :
+            Data(std::in_place_index<1>, std::forward<Ts>(Args)...) {
+            StoreHasValue(false);
+        }
+
+        [[nodiscard]] bool LoadHasValue() const noexcept {
+            return NicheByte() != NicheTraits<T>::Value;
+        }
+
+        void StoreHasValue(bool bValue) noexcept {
+            // The value writes its own niche byte when it is constructed.
+            if (!bValue) {
+                NicheByte() = NicheTraits<T>::Value;
+            }
+        }
+
+        ExpectedUnion<T, E> Data;
+
+    private:
+        [[nodiscard]] const unsigned char& NicheByte() const noexcept {
+            return reinterpret_cast<const unsigned char*>(std::addressof(Data))[NicheTraits<T>::Offset];
+        }
+
+        [[nodiscard]] unsigned char& NicheByte() noexcept {
+            return reinterpret_cast<unsigned char*>(std::addressof(Data))[NicheTraits<T>::Offset];
+        }
+    };
+
+    template <typename T, typename E>
+    struct ExpectedPayload<T, E, ENichePlacement::InError> {
+        explicit ExpectedPayload(valueless_t) noexcept : Data(valueless) {
+            StoreHasValue(true);
+        }
+
+        template <typename... Ts>
+        explicit ExpectedPayload(std::in_place_index_t<0>, Ts&&... Args) noexcept(
+            NothrowConstructible<ExpectedUnion<T, E>, std::in_place_index_t<0>, Ts...>()) :
+            Data(std::in_place_index<0>, std::forward<Ts>(Args)...) {
+            StoreHasValue(true);
+        }
+
+        template <typename... Ts>
+        explicit constexpr ExpectedPayload(std::in_place_index_t<1>, Ts&&... Args) noexcept(
+            NothrowConstructible<ExpectedUnion<T, E>, std::in_place_index_t<1>, Ts...>()) :
+            Data(std::in_place_index<1>, std::forward<Ts>(Args)...) {}
+
+        [[nodiscard]] bool LoadHasValue() const noexcept {
+            return NicheByte() == NicheTraits<E>::Value;
+        }
+
+        void StoreHasValue(bool bValue) noexcept {
+            // The error writes its own niche byte when it is constructed.
+            if (bValue) {
+                NicheByte() = NicheTraits<E>::Value;
+            }
+        }
+
+        ExpectedUnion<T, E> Data;
+
+    private:
+        [[nodiscard]] const unsigned char& NicheByte() const noexcept {
+            return reinterpret_cast<const unsigned char*>(std::addressof(Data))[NicheTraits<E>::Offset];
+        }
+
+        [[nodiscard]] unsigned char& NicheByte() noexcept {
+            return reinterpret_cast<unsigned char*>(std::addressof(Data))[NicheTraits<E>::Offset];
+        }
+    };
+}
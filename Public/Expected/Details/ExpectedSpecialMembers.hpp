@@ -0,0 +1,373 @@
+#pragma once
+
+#include "ExpectedStorage.hpp"
+
+namespace stdx::details {
+    enum class ESpecialMember { Disabled, Trivial, NonTrivial };
+
+    constexpr ESpecialMember SelectSpecialMember(bool bEnabled, bool bTrivial) noexcept {
+        if (!bEnabled) {
+            return ESpecialMember::Disabled;
+        }
+        return bTrivial ? ESpecialMember::Trivial : ESpecialMember::NonTrivial;
+    }
+
+    // How every special member of Expected<T, E> is provided, computed in a single instantiation. Plain boolean
+    // expressions are used on purpose: each And/Or from Traits.hpp would instantiate a std::conjunction of its own.
+    template <typename T, typename E>
+    struct SpecialMembers {
+        static constexpr bool bVoid = std::is_void_v<T>;
+
+        static constexpr bool bTriviallyDestructible =
+            (bVoid || std::is_trivially_destructible_v<T>) && std::is_trivially_destructible_v<E>;
+
+        static constexpr bool bCopyConstructible = (bVoid || std::is_copy_constructible_v<T>) && std::is_copy_constructible_v<E>;
+
+        static constexpr bool bTriviallyCopyConstructible =
+            (bVoid || std::is_trivially_copy_constructible_v<T>) && std::is_trivially_copy_constructible_v<E>;
+
+        static constexpr bool bMoveConstructible = (bVoid || std::is_move_constructible_v<T>) && std::is_move_constructible_v<E>;
+
+        static constexpr bool bTriviallyMoveConstructible =
+            (bVoid || std::is_trivially_move_constructible_v<T>) && std::is_trivially_move_constructible_v<E>;
+
+        // Switching alternatives needs a backup of one of them, which must be restorable without throwing.
+        static constexpr bool bNothrowBackup =
+            bVoid || std::is_nothrow_move_constructible_v<T> || std::is_nothrow_move_constructible_v<E>;
+
+        static constexpr ESpecialMember Destructor = SelectSpecialMember(true, bTriviallyDestructible);
+
+        static constexpr ESpecialMember CopyConstructor = SelectSpecialMember(bCopyConstructible, bTriviallyCopyConstructible);
+
+        static constexpr ESpecialMember MoveConstructor = SelectSpecialMember(bMoveConstructible, bTriviallyMoveConstructible);
+
+        static constexpr ESpecialMember CopyAssignment = SelectSpecialMember(
+            bCopyConstructible && bNothrowBackup && (bVoid || std::is_move_assignable_v<T>) && std::is_move_assignable_v<E>,
+            bTriviallyCopyConstructible && bTriviallyDestructible && (bVoid || std::is_trivially_copy_assignable_v<T>) &&
+                std::is_trivially_copy_assignable_v<E>);
+
+        static constexpr ESpecialMember MoveAssignment = SelectSpecialMember(
+            bMoveConstructible && bNothrowBackup && (bVoid || std::is_move_assignable_v<T>) && std::is_move_assignable_v<E>,
+            bTriviallyMoveConstructible && bTriviallyDestructible && (bVoid || std::is_trivially_move_assignable_v<T>) &&
+                std::is_trivially_move_assignable_v<E>);
+    };
+
+    template <typename T, typename E>
+    constexpr bool NothrowCopyConstruction() noexcept {
+        return And<VoidOrNothrowCopyConstructible<T>, NothrowCopyConstructible<E>>();
+    }
+
+    template <typename T, typename E>
+    constexpr bool NothrowMoveConstruction() noexcept {
+        return And<VoidOrNothrowMoveConstructible<T>, NothrowMoveConstructible<E>>();
+    }
+
+    template <typename T, typename E>
+    constexpr bool NothrowCopyAssignment() noexcept {
+        return And<
+            VoidOrNothrowCopyConstructible<T>,
+            NothrowCopyConstructible<E>,
+            Or<IsVoid<T>, NothrowAssignableThroughTemporary<T, std::add_lvalue_reference_t<const T>>>,
+            NothrowAssignableThroughTemporary<E, const E&>>();
+    }
+
+    template <typename T, typename E>
+    constexpr bool NothrowMoveAssignment() noexcept {
+        return And<
+            VoidOrNothrowMoveConstructible<T>,
+            NothrowMoveConstructible<E>,
+            VoidOrNothrowMoveAssignable<T>,
+            NothrowMoveAssignable<E>>();
+    }
+
+#if defined(_EXPECTED_CONSTRAINED_SPECIAL_MEMBERS)
+    // Deletes the special members Expected must not have. GCC stops treating a class as trivially copyable when one
+    // of its special members is user-provided and ineligible while the eligible one is deleted, so ExpectedSpecialMembers
+    // never deletes anything itself: its defaulted members come out deleted through this base.
+    template <bool bCopyConstructor, bool bMoveConstructor, bool bCopyAssignment, bool bMoveAssignment>
+    struct EnableSpecialMembers {
+        EnableSpecialMembers() = default;
+
+        EnableSpecialMembers(const EnableSpecialMembers&) requires bCopyConstructor = default;
+
+        EnableSpecialMembers(const EnableSpecialMembers&) requires(!bCopyConstructor) = delete;
+
+        EnableSpecialMembers(EnableSpecialMembers&&) requires bMoveConstructor = default;
+
+        EnableSpecialMembers(EnableSpecialMembers&&) requires(!bMoveConstructor) = delete;
+
+        EnableSpecialMembers& operator=(const EnableSpecialMembers&) requires bCopyAssignment = default;
+
+        EnableSpecialMembers& operator=(const EnableSpecialMembers&) requires(!bCopyAssignment) = delete;
+
+        EnableSpecialMembers& operator=(EnableSpecialMembers&&) requires bMoveAssignment = default;
+
+        EnableSpecialMembers& operator=(EnableSpecialMembers&&) requires(!bMoveAssignment) = delete;
+    };
+
+    template <typename T, typename E, typename Members = SpecialMembers<T, E>>
+    using EnableSpecialMembersFor = EnableSpecialMembers<
+        Members::CopyConstructor != ESpecialMember::Disabled,
+        Members::MoveConstructor != ESpecialMember::Disabled,
+        Members::CopyAssignment != ESpecialMember::Disabled,
+        Members::MoveAssignment != ESpecialMember::Disabled>;
+
+    // Each special member is declared once defaulted and once user-provided, and the constraints pick the eligible one.
+    // An Expected thus instantiates this class and its storage, whichever of its members are trivial or deleted.
+    template <typename T, typename E>
+    class ExpectedSpecialMembers : public ExpectedStorage<T, E>, private EnableSpecialMembersFor<T, E> {
+        using Super = ExpectedStorage<T, E>;
+        using Members = SpecialMembers<T, E>;
+
+    public:
+        using Super::Super;
+
+        ExpectedSpecialMembers() = default;
+
+        ExpectedSpecialMembers(const ExpectedSpecialMembers&) requires(Members::CopyConstructor != ESpecialMember::NonTrivial) =
+            default;
+
+        _EXPECTED_CONSTEXPR20 ExpectedSpecialMembers(const ExpectedSpecialMembers& Other) noexcept(
+            NothrowCopyConstruction<T, E>()) requires(Members::CopyConstructor == ESpecialMember::NonTrivial) :
+            Super() {
+            Super::ConstructFrom(Other);
+        }
+
+        ExpectedSpecialMembers(ExpectedSpecialMembers&&) requires(Members::MoveConstructor != ESpecialMember::NonTrivial) =
+            default;
+
+        _EXPECTED_CONSTEXPR20 ExpectedSpecialMembers(ExpectedSpecialMembers&& Other) noexcept(
+            NothrowMoveConstruction<T, E>()) requires(Members::MoveConstructor == ESpecialMember::NonTrivial) :
+            Super() {
+            Super::ConstructFrom(std::move(Other));
+        }
+
+        ExpectedSpecialMembers& operator=(const ExpectedSpecialMembers&) requires(
+            Members::CopyAssignment != ESpecialMember::NonTrivial) = default;
+
+        _EXPECTED_CONSTEXPR20 ExpectedSpecialMembers& operator=(const ExpectedSpecialMembers& Other) noexcept(
+            NothrowCopyAssignment<T, E>()) requires(Members::CopyAssignment == ESpecialMember::NonTrivial) {
+            Super::AssignFrom(Other);
+            return *this;
+        }
+
+        ExpectedSpecialMembers& operator=(ExpectedSpecialMembers&&) requires(
+            Members::MoveAssignment != ESpecialMember::NonTrivial) = default;
+
+        _EXPECTED_CONSTEXPR20 ExpectedSpecialMembers& operator=(ExpectedSpecialMembers&& Other) noexcept(
+            NothrowMoveAssignment<T, E>()) requires(Members::MoveAssignment == ESpecialMember::NonTrivial) {
+            Super::AssignFrom(std::move(Other));
+            return *this;
+        }
+
+        ~ExpectedSpecialMembers() requires(Members::Destructor == ESpecialMember::Trivial) = default;
+
+        _EXPECTED_CONSTEXPR20 ~ExpectedSpecialMembers() requires(Members::Destructor == ESpecialMember::NonTrivial) {
+            Super::Destroy();
+        }
+    };
+#else
+    // Before C++20 a special member can only be made trivial, user-provided or deleted by inheriting it, so each one
+    // that is not trivial takes a layer of its own. Trivial layers are left out of the chain altogether: the defaulted
+    // member of the layer below is already trivial.
+    template <typename Layer, typename Base, ESpecialMember Selector>
+    using SpecialMemberLayer = Conditional<BoolConstant<Selector == ESpecialMember::Trivial>, Base, Layer>;
+
+    template <typename T, typename E, ESpecialMember = SpecialMembers<T, E>::Destructor>
+    struct BaseDestructor;
+
+    template <typename T, typename E>
+    using DestructorLayer = SpecialMemberLayer<BaseDestructor<T, E>, ExpectedStorage<T, E>, SpecialMembers<T, E>::Destructor>;
+
+    template <typename T, typename E, ESpecialMember = SpecialMembers<T, E>::CopyConstructor>
+    struct BaseCopyConstructor;
+
+    template <typename T, typename E>
+    using CopyConstructorLayer =
+        SpecialMemberLayer<BaseCopyConstructor<T, E>, DestructorLayer<T, E>, SpecialMembers<T, E>::CopyConstructor>;
+
+    template <typename T, typename E, ESpecialMember = SpecialMembers<T, E>::MoveConstructor>
+    struct BaseMoveConstructor;
+
+    template <typename T, typename E>
+    using MoveConstructorLayer =
+        SpecialMemberLayer<BaseMoveConstructor<T, E>, CopyConstructorLayer<T, E>, SpecialMembers<T, E>::MoveConstructor>;
+
+    template <typename T, typename E, ESpecialMember = SpecialMembers<T, E>::CopyAssignment>
+    struct BaseCopyAssignment;
+
+    template <typename T, typename E>
+    using CopyAssignmentLayer =
+        SpecialMemberLayer<BaseCopyAssignment<T, E>, MoveConstructorLayer<T, E>, SpecialMembers<T, E>::CopyAssignment>;
+
+    template <typename T, typename E, ESpecialMember = SpecialMembers<T, E>::MoveAssignment>
+    struct BaseMoveAssignment;
+
+    template <typename T, typename E>
+    using MoveAssignmentLayer =
+        SpecialMemberLayer<BaseMoveAssignment<T, E>, CopyAssignmentLayer<T, E>, SpecialMembers<T, E>::MoveAssignment>;
+
+    template <typename T, typename E>
+    using ExpectedSpecialMembers = MoveAssignmentLayer<T, E>;
+
+    // A user-declared destructor suppresses the implicit move operations, so this layer has to default them itself.
+    template <typename T, typename E>
+    struct BaseDestructor<T, E, ESpecialMember::NonTrivial> : ExpectedStorage<T, E> {
+        using Super = ExpectedStorage<T, E>;
+        using Super::Super;
+
+        BaseDestructor() = default;
+
+        BaseDestructor(const BaseDestructor&) = default;
+
+        BaseDestructor(BaseDestructor&&) = default;
+
+        BaseDestructor& operator=(const BaseDestructor&) = default;
+
+        BaseDestructor& operator=(BaseDestructor&&) = default;
+
+        _EXPECTED_CONSTEXPR20 ~BaseDestructor() {
+            Super::Destroy();
+        }
+    };
+
+    template <typename T, typename E>
+    struct BaseCopyConstructor<T, E, ESpecialMember::Disabled> : DestructorLayer<T, E> {
+        using Super = DestructorLayer<T, E>;
+        using Super::Super;
+
+        BaseCopyConstructor() = default;
+
+        BaseCopyConstructor(const BaseCopyConstructor&) = delete;
+
+        BaseCopyConstructor(BaseCopyConstructor&&) = default;
+
+        BaseCopyConstructor& operator=(const BaseCopyConstructor&) = default;
+
+        BaseCopyConstructor& operator=(BaseCopyConstructor&&) = default;
+    };
+
+    template <typename T, typename E>
+    struct BaseCopyConstructor<T, E, ESpecialMember::NonTrivial> : DestructorLayer<T, E> {
+        using Super = DestructorLayer<T, E>;
+        using Super::Super;
+
+        BaseCopyConstructor() = default;
+
+        _EXPECTED_CONSTEXPR20 BaseCopyConstructor(const BaseCopyConstructor& Other) noexcept(NothrowCopyConstruction<T, E>()) {
+            Super::ConstructFrom(Other);
+        }
+
+        BaseCopyConstructor(BaseCopyConstructor&&) = default;
+
+        BaseCopyConstructor& operator=(const BaseCopyConstructor&) = default;
+
+        BaseCopyConstructor& operator=(BaseCopyConstructor&&) = default;
+    };
+
+    template <typename T, typename E>
+    struct BaseMoveConstructor<T, E, ESpecialMember::Disabled> : CopyConstructorLayer<T, E> {
+        using Super = CopyConstructorLayer<T, E>;
+        using Super::Super;
+
+        BaseMoveConstructor() = default;
+
+        BaseMoveConstructor(const BaseMoveConstructor&) = default;
+
+        BaseMoveConstructor(BaseMoveConstructor&&) = delete;
+
+        BaseMoveConstructor& operator=(const BaseMoveConstructor&) = default;
+
+        BaseMoveConstructor& operator=(BaseMoveConstructor&&) = default;
+    };
+
+    template <typename T, typename E>
+    struct BaseMoveConstructor<T, E, ESpecialMember::NonTrivial> : CopyConstructorLayer<T, E> {
+        using Super = CopyConstructorLayer<T, E>;
+        using Super::Super;
+
+        BaseMoveConstructor() = default;
+
+        BaseMoveConstructor(const BaseMoveConstructor&) = default;
+
+        _EXPECTED_CONSTEXPR20 BaseMoveConstructor(BaseMoveConstructor&& Other) noexcept(NothrowMoveConstruction<T, E>()) {
+            Super::ConstructFrom(std::move(Other));
+        }
+
+        BaseMoveConstructor& operator=(const BaseMoveConstructor&) = default;
+
+        BaseMoveConstructor& operator=(BaseMoveConstructor&&) = default;
+    };
+
+    template <typename T, typename E>
+    struct BaseCopyAssignment<T, E, ESpecialMember::Disabled> : MoveConstructorLayer<T, E> {
+        using Super = MoveConstructorLayer<T, E>;
+        using Super::Super;
+
+        BaseCopyAssignment() = default;
+
+        BaseCopyAssignment(const BaseCopyAssignment&) = default;
+
+        BaseCopyAssignment(BaseCopyAssignment&&) = default;
+
+        BaseCopyAssignment& operator=(const BaseCopyAssignment&) = delete;
+
+        BaseCopyAssignment& operator=(BaseCopyAssignment&&) = default;
+    };
+
+    template <typename T, typename E>
+    struct BaseCopyAssignment<T, E, ESpecialMember::NonTrivial> : MoveConstructorLayer<T, E> {
+        using Super = MoveConstructorLayer<T, E>;
+        using Super::Super;
+
+        BaseCopyAssignment() = default;
+
+        BaseCopyAssignment(const BaseCopyAssignment&) = default;
+
+        BaseCopyAssignment(BaseCopyAssignment&&) = default;
+
+        _EXPECTED_CONSTEXPR20 BaseCopyAssignment& operator=(const BaseCopyAssignment& Other) noexcept(
+            NothrowCopyAssignment<T, E>()) {
+            Super::AssignFrom(Other);
+            return *this;
+        }
+
+        BaseCopyAssignment& operator=(BaseCopyAssignment&&) = default;
+    };
+
+    template <typename T, typename E>
+    struct BaseMoveAssignment<T, E, ESpecialMember::Disabled> : CopyAssignmentLayer<T, E> {
+        using Super = CopyAssignmentLayer<T, E>;
+        using Super::Super;
+
+        BaseMoveAssignment() = default;
+
+        BaseMoveAssignment(const BaseMoveAssignment&) = default;
+
+        BaseMoveAssignment(BaseMoveAssignment&&) = default;
+
+        BaseMoveAssignment& operator=(const BaseMoveAssignment&) = default;
+
+        BaseMoveAssignment& operator=(BaseMoveAssignment&&) = delete;
+    };
+
+    template <typename T, typename E>
+    struct BaseMoveAssignment<T, E, ESpecialMember::NonTrivial> : CopyAssignmentLayer<T, E> {
+        using Super = CopyAssignmentLayer<T, E>;
+        using Super::Super;
+
+        BaseMoveAssignment() = default;
+
+        BaseMoveAssignment(const BaseMoveAssignment&) = default;
+
+        BaseMoveAssignment(BaseMoveAssignment&&) = default;
+
+        BaseMoveAssignment& operator=(const BaseMoveAssignment&) = default;
+
+        _EXPECTED_CONSTEXPR20 BaseMoveAssignment& operator=(BaseMoveAssignment&& Other) noexcept(NothrowMoveAssignment<T, E>()) {
+            Super::AssignFrom(std::move(Other));
+            return *this;
+        }
+    };
+#endif
+}
@@ -1,67 +1,313 @@
+#pragma once
+
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <new>
 #include <utility>
 
 #include <Expected/BadExpectedAccess.hpp>
+#include <Expected/RelocationTraits.hpp>
 
-#include "BaseExpectedStorage.hpp"
-#include "ExpectedUnion.hpp"
+#include "ExpectedPayload.hpp"
+#include "UsesAllocator.hpp"
 
 namespace stdx::details {
+    // Placement new cannot appear in a constant expression, std::construct_at can.
+    template <typename X, typename... Ts>
+    _EXPECTED_CONSTEXPR20 void ConstructAt(X* Where, Ts&&... Args) noexcept(NothrowConstructible<X, Ts...>()) {
+#if defined(__cpp_lib_constexpr_dynamic_alloc)
+        std::construct_at(Where, std::forward<Ts>(Args)...);
+#else
+        ::new (static_cast<void*>(Where)) X(std::forward<Ts>(Args)...);
+#endif
+    }
+
+    // Alternatives that can be moved around as plain bytes, see IsTriviallyRelocatable. A reference is held as a pointer.
     template <typename T, typename E>
-    class ExpectedStorage : public BaseExpectedStorage<T, E> {
-        using Super = BaseExpectedStorage<T, E>;
+    using TriviallyRelocatableAlternatives =
+        And<Or<IsVoid<T>, IsLvalueReference<T>, IsTriviallyRelocatable<T>>, IsTriviallyRelocatable<E>>;
+
+    template <typename T, typename E>
+    class ExpectedStorage : protected ExpectedPayload<T, E> {
+        using Payload = ExpectedPayload<T, E>;
 
     public:
-        using Super::Super;
+        using ValueType = T;
+        using ErrorType = E;
+        using UnexpectedType = Unexpected<E>;
 
-        [[nodiscard]] constexpr const T& operator*() const& noexcept {
-            return Super::Data.Value;
+        [[nodiscard]] constexpr bool HasValue() const noexcept {
+            return Payload::LoadHasValue();
         }
 
-        [[nodiscard]] constexpr T& operator*() & noexcept {
-            return Super::Data.Value;
+        [[nodiscard]] constexpr explicit operator bool() const noexcept {
+            return HasValue();
         }
 
-        [[nodiscard]] constexpr const T&& operator*() const&& noexcept {
-            return std::move(Super::Data.Value);
+        [[nodiscard]] constexpr const E& Error() const& noexcept {
+            return Payload::Data.Unex.Value();
         }
 
-        [[nodiscard]] constexpr T&& operator*() && noexcept {
-            return std::move(Super::Data.Value);
+        [[nodiscard]] constexpr E& Error() & noexcept {
+            return Payload::Data.Unex.Value();
         }
 
-        [[nodiscard]] constexpr const T* operator->() const noexcept {
-            return std::addressof(**this);
+        [[nodiscard]] constexpr const E&& Error() const&& noexcept {
+            return std::move(Payload::Data.Unex).Value();
         }
 
-        [[nodiscard]] constexpr T* operator->() noexcept {
-            return std::addressof(**this);
+        [[nodiscard]] constexpr E&& Error() && noexcept {
+            return std::move(Payload::Data.Unex).Value();
+        }
+
+        // The error, or Default when there is a value.
+        template <typename G>
+        [[nodiscard]] constexpr E ErrorOr(G&& Default) const& {
+            return HasValue() ? static_cast<E>(std::forward<G>(Default)) : Error();
+        }
+
+        template <typename G>
+        [[nodiscard]] constexpr E ErrorOr(G&& Default) && {
+            return HasValue() ? static_cast<E>(std::forward<G>(Default)) : std::move(*this).Error();
+        }
+
+        // Like ErrorOr, but the fallback is only made when there is a value, by calling Factory with no argument.
+        template <typename F>
+        [[nodiscard]] constexpr E ErrorOrElse(F&& Factory) const& {
+            return HasValue() ? static_cast<E>(std::invoke(std::forward<F>(Factory))) : Error();
+        }
+
+        template <typename F>
+        [[nodiscard]] constexpr E ErrorOrElse(F&& Factory) && {
+            return HasValue() ? static_cast<E>(std::invoke(std::forward<F>(Factory))) : std::move(*this).Error();
         }
 
     protected:
+        constexpr ExpectedStorage() noexcept : Payload(valueless) {}
+
         template <typename... Ts>
-        void ConstructValue(Ts&&... Args) noexcept(NothrowConstructible<T, Ts...>()) {
-            ::new (static_cast<void*>(std::addressof(Super::Data.Value))) T(std::forward<Ts>(Args)...);
+        explicit constexpr ExpectedStorage(std::in_place_index_t<0>, Ts&&... Args) noexcept(
+            NothrowConstructible<Payload, std::in_place_index_t<0>, Ts...>()) :
+            Payload(std::in_place_index<0>, std::forward<Ts>(Args)...) {}
+
+        template <typename... Ts>
+        explicit constexpr ExpectedStorage(std::in_place_index_t<1>, Ts&&... Args) noexcept(
+            NothrowConstructible<Payload, std::in_place_index_t<1>, Ts...>()) :
+            Payload(std::in_place_index<1>, std::forward<Ts>(Args)...) {}
+
+        template <typename Self>
+        [[nodiscard]] static constexpr auto&& ValueOf(Self&& This) noexcept {
+            return std::forward<Self>(This).Data.Value;
+        }
+
+        template <typename... Ts>
+        _EXPECTED_CONSTEXPR20 void ConstructValue(Ts&&... Args) noexcept(NothrowConstructible<T, Ts...>()) {
+            ConstructAt(std::addressof(Payload::Data.Value), std::forward<Ts>(Args)...);
         }
 
         template <typename U>
-        void AssignValue(U&& Value) noexcept(NothrowAssignable<T&, U>()) {
-            Super::Data.Value = std::forward<U>(Value);
+        _EXPECTED_CONSTEXPR20 void AssignValue(U&& Value) noexcept(NothrowAssignableThroughTemporary<T, U>()) {
+            if constexpr (Assignable<T&, U>()) {
+                Payload::Data.Value = std::forward<U>(Value);
+            } else {
+                Payload::Data.Value = T(std::forward<U>(Value));
+            }
         }
 
         constexpr void DestroyValue() noexcept {
             if constexpr (!TriviallyDestructible<T>()) {
-                Super::Data.Value.~T();
+                Payload::Data.Value.~T();
             }
         }
-    };
 
-    template <typename E>
-    class ExpectedStorage<void, E> : public BaseExpectedStorage<void, E> {
-        using Super = BaseExpectedStorage<void, E>;
+        template <typename... Ts>
+        _EXPECTED_CONSTEXPR20 void ConstructUnexpected(Ts&&... Args) noexcept(NothrowConstructible<E, Ts...>()) {
+            ConstructAt(std::addressof(Payload::Data.Unex), untracked, std::forward<Ts>(Args)...);
+        }
 
-    public:
-        using Super::Super;
+        template <typename G>
+        _EXPECTED_CONSTEXPR20 void AssignUnexpected(G&& Error) noexcept(NothrowAssignableThroughTemporary<E, G>()) {
+            if constexpr (Assignable<E&, G>()) {
+                Payload::Data.Unex.Value() = std::forward<G>(Error);
+            } else {
+                Payload::Data.Unex.Value() = E(std::forward<G>(Error));
+            }
+        }
+
+        constexpr void DestroyUnexpected() noexcept {
+            if constexpr (!TriviallyDestructible<E>()) {
+                Payload::Data.Unex.~Unexpected<E>();
+            }
+        }
+
+        // Uses-allocator construction of the alternatives, for the allocator-extended constructors and Emplace.
+        template <typename A, typename... Ts>
+        void ConstructValueUsing(const A& Alloc, Ts&&... Args) {
+            ::new (static_cast<void*>(std::addressof(Payload::Data.Value)))
+                T(MakeUsingAllocator<T>(Alloc, std::forward<Ts>(Args)...));
+        }
+
+        template <typename A, typename... Ts>
+        void ConstructUnexpectedUsing(const A& Alloc, Ts&&... Args) {
+            ::new (static_cast<void*>(std::addressof(Payload::Data.Unex))) Unexpected<E>(in_place_invoke, [&]() -> E {
+                return MakeUsingAllocator<E>(Alloc, std::forward<Ts>(Args)...);
+            });
+        }
+
+        // Replacements of one alternative by the other that keep the allocator of the one replaced, see
+        // PropagatesAllocator.
+        template <typename... Ts>
+        void PropagateIntoValue(Ts&&... Args) {
+            T Tmp(MakeUsingAllocator<T>(Error().get_allocator(), std::forward<Ts>(Args)...));
+            DestroyUnexpected();
+            ConstructValue(std::move(Tmp));
+        }
+
+        template <typename... Ts>
+        void PropagateIntoUnexpected(Ts&&... Args) {
+            E Tmp(MakeUsingAllocator<E>(Payload::Data.Value.get_allocator(), std::forward<Ts>(Args)...));
+            DestroyValue();
+            ConstructUnexpected(std::move(Tmp));
+        }
+
+        constexpr void SetHasValue(bool bValue) noexcept {
+            Payload::StoreHasValue(bValue);
+        }
+
+        // Exchanges the alternatives of two Expecteds along with their discriminants, whichever they hold, as a fixed-size
+        // copy each way. Only for trivially relocatable alternatives.
+        void SwapBytes(ExpectedStorage& Other) noexcept {
+            static_assert(TriviallyRelocatableAlternatives<T, E>());
+
+            // memcpy does not allow its source and destination to overlap, as they would in a self-swap.
+            if (this == std::addressof(Other)) {
+                return;
+            }
+            void* const Mine = static_cast<Payload*>(this);
+            void* const Theirs = static_cast<Payload*>(std::addressof(Other));
+            alignas(Payload) unsigned char Tmp[sizeof(Payload)];
+            std::memcpy(Tmp, Mine, sizeof(Payload));
+            std::memcpy(Mine, Theirs, sizeof(Payload));
+            std::memcpy(Theirs, Tmp, sizeof(Payload));
+        }
+
+        /*
+         * Rollbacks of the assignments that destroy the alternative they replace before constructing the new one: called
+         * from their catch handlers with the backup taken beforehand, they put it back. A constructor throwing is the
+         * exception, so they are kept out of line, away from the code that runs.
+         */
+
+        template <typename Backup>
+        _EXPECTED_COLD void RestoreValue(Backup&& Value) {
+            ConstructValue(std::forward<Backup>(Value));
+            SetHasValue(true);
+        }
+
+        template <typename Backup>
+        _EXPECTED_COLD void RestoreUnexpected(Backup&& Unex) {
+            ConstructUnexpected(std::forward<Backup>(Unex));
+            SetHasValue(false);
+        }
+
+        /*
+         * Bodies of the non-trivial special members. Other is an lvalue of the same Expected for the copying members
+         * and an rvalue for the moving ones; they are shared by both ways ExpectedSpecialMembers can be declared.
+         */
+
+        _EXPECTED_CONSTEXPR20 void Destroy() noexcept {
+            if (HasValue()) {
+                if constexpr (!IsVoid<T>()) {
+                    DestroyValue();
+                }
+            } else {
+                DestroyUnexpected();
+            }
+        }
+
+        template <typename Self>
+        _EXPECTED_CONSTEXPR20 void ConstructFrom(Self&& Other) {
+            if (Other.HasValue()) {
+                if constexpr (!IsVoid<T>()) {
+                    ConstructValue(ValueOf(std::forward<Self>(Other)));
+                }
+            } else {
+                ConstructUnexpected(std::forward<Self>(Other).Error());
+            }
+            SetHasValue(Other.HasValue());
+        }
+
+        template <typename Self>
+        _EXPECTED_CONSTEXPR20 void AssignFrom(Self&& Other) {
+            if (Other.HasValue()) {
+                if (HasValue()) {
+                    if constexpr (!IsVoid<T>()) {
+                        AssignValue(ValueOf(std::forward<Self>(Other)));
+                    }
+                } else {
+                    AssignValueOverUnexpected(std::forward<Self>(Other));
+                }
+            } else {
+                if (HasValue()) {
+                    AssignUnexpectedOverValue(std::forward<Self>(Other));
+                } else {
+                    AssignUnexpected(std::forward<Self>(Other).Error());
+                }
+            }
+            SetHasValue(Other.HasValue());
+        }
+
+    private:
+        template <typename Self>
+        _EXPECTED_CONSTEXPR20 void AssignValueOverUnexpected(Self&& Other) {
+            if constexpr (IsVoid<T>()) {
+                DestroyUnexpected();
+            } else if constexpr (PropagatesAllocator<E, T, decltype(ValueOf(std::declval<Self>()))>()) {
+                PropagateIntoValue(ValueOf(std::forward<Self>(Other)));
+            } else if constexpr (NothrowOrNoExceptions<NothrowConstructible<T, decltype(ValueOf(std::declval<Self>()))>>()) {
+                DestroyUnexpected();
+                ConstructValue(ValueOf(std::forward<Self>(Other)));
+            } else if constexpr (NothrowMoveConstructible<T>()) {
+                T Tmp(ValueOf(std::forward<Self>(Other)));
+                DestroyUnexpected();
+                ConstructValue(std::move(Tmp));
+            } else {
+                E Tmp(std::move(Error()));
+                DestroyUnexpected();
+                _EXPECTED_TRY {
+                    ConstructValue(ValueOf(std::forward<Self>(Other)));
+                }
+                _EXPECTED_CATCH_ALL {
+                    RestoreUnexpected(std::move(Tmp));
+                    _EXPECTED_RETHROW;
+                }
+            }
+        }
+
+        template <typename Self>
+        _EXPECTED_CONSTEXPR20 void AssignUnexpectedOverValue(Self&& Other) {
+            if constexpr (IsVoid<T>()) {
+                ConstructUnexpected(std::forward<Self>(Other).Error());
+            } else if constexpr (PropagatesAllocator<T, E, decltype(std::declval<Self>().Error())>()) {
+                PropagateIntoUnexpected(std::forward<Self>(Other).Error());
+            } else if constexpr (NothrowOrNoExceptions<NothrowConstructible<E, decltype(std::declval<Self>().Error())>>()) {
+                DestroyValue();
+                ConstructUnexpected(std::forward<Self>(Other).Error());
+            } else if constexpr (NothrowMoveConstructible<E>()) {
+                E Tmp(std::forward<Self>(Other).Error());
+                DestroyValue();
+                ConstructUnexpected(std::move(Tmp));
+            } else {
+                T Tmp(std::move(Payload::Data.Value));
+                DestroyValue();
+                _EXPECTED_TRY {
+                    ConstructUnexpected(std::forward<Self>(Other).Error());
+                }
+                _EXPECTED_CATCH_ALL {
+                    RestoreValue(std::move(Tmp));
+                    _EXPECTED_RETHROW;
+                }
+            }
+        }
     };
-}
\ No newline at end of file
+}
@@ -85,4 +85,29 @@ namespace stdx::details {
     struct EmplacebleFromTs :
         Or<NothrowConstructible<T, Ts...>,
            And<Constructible<T, Ts...>, MoveAssignable<T>, Or<NothrowMoveConstructible<T>, NothrowMoveConstructible<E>>>> {};
+
+    // Expected<T&, E> only binds to lvalues: a temporary would be gone before the Expected referring to it.
+    template <typename T, typename U, typename K = RemoveCVRef<U>>
+    struct BindsReference :
+        And<IsLvalueReference<U>,
+            Convertible<std::remove_reference_t<U>*, T*>,
+            Not<IsExpectedSpecialization<K>>,
+            Not<IsUnexpectedSpecialization<K>>> {};
+
+    template <typename T, typename E, typename U, typename G>
+    struct CopyConstructibleFromReference {
+        using Result = And<Not<And<Same<T, U>, Same<E, G>>>, Convertible<U*, T*>, Constructible<E, const G&>>;
+
+        static constexpr bool Implicit = Result() && Convertible<const G&, E>();
+        static constexpr bool Explicit = Result() && !Convertible<const G&, E>();
+        static constexpr bool Nothrow = NothrowConstructible<E, const G&>();
+    };
+
+    // Whether ordering the values of an Expected<T1, E1> and an Expected<T2, E2> cannot throw. Two values of
+    // Expected<void, E> are equivalent, so there is nothing to compare.
+    template <typename T1, typename T2, bool = IsVoid<T1>() && IsVoid<T2>()>
+    struct NothrowLessValues : BoolConstant<noexcept(bool(std::declval<const T1&>() < std::declval<const T2&>()))> {};
+
+    template <typename T1, typename T2>
+    struct NothrowLessValues<T1, T2, true> : std::true_type {};
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 #include <Expected/Unexpected.hpp>
 
 #include "Traits.hpp"
@@ -24,12 +26,22 @@ namespace stdx::details {
             NothrowConstructible<T, Ts...>::value) :                                                                             \
             Value(std::forward<Ts>(Args)...) {}                                                                                  \
                                                                                                                                  \
+        template <typename F, typename... Ts>                                                                                    \
+        explicit constexpr ExpectedUnion(std::in_place_index_t<0>, in_place_invoke_t, F&& Func, Ts&&... Args) noexcept(          \
+            NothrowInvocable<F, Ts...>::value) :                                                                                 \
+            Value(std::invoke(std::forward<F>(Func), std::forward<Ts>(Args)...)) {}                                              \
+                                                                                                                                 \
         template <typename... Ts>                                                                                                \
         explicit constexpr ExpectedUnion(std::in_place_index_t<1>, Ts&&... Args) noexcept(                                       \
-            NothrowConstructible<Unexpected<E>, Ts...>::value) :                                                                 \
-            Unex(std::forward<Ts>(Args)...) {}                                                                                   \
+            NothrowConstructible<E, Ts...>::value) :                                                                             \
+            Unex(untracked, std::forward<Ts>(Args)...) {}                                                                        \
+                                                                                                                                 \
+        template <typename F, typename... Ts>                                                                                    \
+        explicit constexpr ExpectedUnion(std::in_place_index_t<1>, in_place_invoke_t, F&& Func, Ts&&... Args) noexcept(          \
+            NothrowInvocable<F, Ts...>::value) :                                                                                 \
+            Unex(in_place_invoke, std::forward<F>(Func), std::forward<Ts>(Args)...) {}                                           \
                                                                                                                                  \
-        Destructor;                                                                                                              \
+        Destructor                                                                                                               \
                                                                                                                                  \
         valueless_t __Dummy;                                                                                                     \
         T Value;                                                                                                                 \
@@ -42,20 +54,32 @@ namespace stdx::details {
                                                                                                                                  \
         explicit constexpr ExpectedUnion(std::in_place_index_t<0>) noexcept : ExpectedUnion(valueless) {}                        \
                                                                                                                                  \
+        template <typename F, typename... Ts>                                                                                    \
+        explicit constexpr ExpectedUnion(std::in_place_index_t<0>, in_place_invoke_t, F&& Func, Ts&&... Args) noexcept(          \
+            NothrowInvocable<F, Ts...>::value) :                                                                                 \
+            ExpectedUnion((void(std::invoke(std::forward<F>(Func), std::forward<Ts>(Args)...)), valueless)) {}                   \
+                                                                                                                                 \
         template <typename... Ts>                                                                                                \
         explicit constexpr ExpectedUnion(std::in_place_index_t<1>, Ts&&... Args) noexcept(                                       \
-            NothrowConstructible<Unexpected<E>, Ts...>::value) :                                                                 \
-            Unex(std::forward<Ts>(Args)...) {}                                                                                   \
+            NothrowConstructible<E, Ts...>::value) :                                                                             \
+            Unex(untracked, std::forward<Ts>(Args)...) {}                                                                        \
+                                                                                                                                 \
+        template <typename F, typename... Ts>                                                                                    \
+        explicit constexpr ExpectedUnion(std::in_place_index_t<1>, in_place_invoke_t, F&& Func, Ts&&... Args) noexcept(          \
+            NothrowInvocable<F, Ts...>::value) :                                                                                 \
+            Unex(in_place_invoke, std::forward<F>(Func), std::forward<Ts>(Args)...) {}                                           \
                                                                                                                                  \
-        Destructor;                                                                                                              \
+        Destructor                                                                                                               \
                                                                                                                                  \
         valueless_t __Dummy;                                                                                                     \
         Unexpected<E> Unex;                                                                                                      \
     };
 
-    _EXPECTED_UNION(true, ~ExpectedUnion() = default)
+    // No destructor is declared at all for the trivial case: a user-declared one, even defaulted, suppresses the implicit
+    // move operations, which would leave trivially copyable move-only alternatives without a move constructor.
+    _EXPECTED_UNION(true, )
 
-    _EXPECTED_UNION(false, ~ExpectedUnion(){})
+    _EXPECTED_UNION(false, _EXPECTED_CONSTEXPR20 ~ExpectedUnion() {})
 
 #undef _EXPECTED_UNION
 }
\ No newline at end of file
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "Traits.hpp"
+
+namespace stdx::details {
+    template <typename X, typename = std::void_t<>>
+    struct Hashable : std::false_type {};
+
+    template <typename X>
+    struct Hashable<X, std::void_t<decltype(std::hash<X>()(std::declval<const X&>()))>> : std::true_type {};
+
+    // The type actually hashed for an alternative: references hash their referent, and std::hash is never cv-qualified.
+    template <typename T>
+    using HashedType = std::remove_cv_t<std::remove_reference_t<T>>;
+
+    template <typename T>
+    using VoidOrHashable = Or<IsVoid<T>, Hashable<HashedType<T>>>;
+
+    // What the standard calls a disabled specialization of std::hash, for alternatives that cannot be hashed.
+    struct DisabledHash {
+        DisabledHash() = delete;
+        DisabledHash(const DisabledHash&) = delete;
+        DisabledHash& operator=(const DisabledHash&) = delete;
+    };
+
+    // Mixes Value into Seed, as boost::hash_combine does.
+    constexpr std::size_t CombineHash(std::size_t Seed, std::size_t Value) noexcept {
+        return Seed ^ (Value + std::size_t(0x9E3779B97F4A7C15ull) + (Seed << 6) + (Seed >> 2));
+    }
+
+    // Spreads every bit of Value over the low ones (the MurmurHash3 finalizer), for hashes that leave them constant.
+    constexpr std::size_t MixHash(std::size_t Value) noexcept {
+        std::uint64_t X = Value;
+        X ^= X >> 33;
+        X *= 0xFF51AFD7ED558CCDull;
+        X ^= X >> 33;
+        X *= 0xC4CEB9FE1A85EC53ull;
+        X ^= X >> 33;
+        return std::size_t(X);
+    }
+}
@@ -3,6 +3,7 @@
 #include <type_traits>
 #include <utility>
 
+#include <Expected/Config.hpp>
 #include <Expected/Tags.hpp>
 
 namespace stdx {
@@ -14,6 +15,12 @@ namespace stdx {
 }
 
 namespace stdx::details {
+    template <typename T, typename E, bool>
+    union ExpectedUnion;
+
+    template <typename T, typename E>
+    class ExpectedStorage;
+
     template <typename T>
     using RemoveCVRef = std::remove_const_t<std::remove_reference_t<T>>;
 
@@ -26,6 +33,9 @@ namespace stdx::details {
     template <typename T>
     using IsScalar = std::is_scalar<T>;
 
+    template <typename T>
+    using IsLvalueReference = std::is_lvalue_reference<T>;
+
     template <bool Value>
     using BoolConstant = std::bool_constant<Value>;
 
@@ -38,6 +48,17 @@ namespace stdx::details {
     template <typename T>
     using Not = std::negation<T>;
 
+#if defined(STDX_EXPECTED_NO_EXCEPTIONS)
+    using ExceptionsEnabled = std::false_type;
+#else
+    using ExceptionsEnabled = std::true_type;
+#endif
+
+    // Without exceptions nothing can unwind half-way through a construction, so every operation may take the direct
+    // (destroy, then construct in place) path otherwise reserved for nothrow ones.
+    template <typename Trait>
+    using NothrowOrNoExceptions = Or<Not<ExceptionsEnabled>, Trait>;
+
     template <typename T1, typename T2>
     using Same = std::is_same<T1, T2>;
 
@@ -101,6 +122,12 @@ namespace stdx::details {
     template <typename T>
     using VoidOrTriviallyMoveConstructible = Or<IsVoid<T>, TriviallyMoveConstructible<T>>;
 
+    template <typename T>
+    using TriviallyCopyable = std::is_trivially_copyable<T>;
+
+    template <typename T>
+    using VoidOrTriviallyCopyable = Or<IsVoid<T>, TriviallyCopyable<T>>;
+
     template <typename T, typename U>
     using Assignable = std::is_assignable<T, U>;
 
@@ -116,6 +143,12 @@ namespace stdx::details {
     template <typename T>
     using VoidOrNothrowCopyAssignable = Or<IsVoid<T>, NothrowCopyAssignable<T>>;
 
+    template <typename T>
+    using TriviallyCopyAssignable = std::is_trivially_copy_assignable<T>;
+
+    template <typename T>
+    using VoidOrTriviallyCopyAssignable = Or<IsVoid<T>, TriviallyCopyAssignable<T>>;
+
     template <typename T>
     using MoveAssignable = std::is_move_assignable<T>;
 
@@ -125,6 +158,12 @@ namespace stdx::details {
     template <typename T>
     using VoidOrNothrowMoveAssignable = Or<IsVoid<T>, NothrowMoveAssignable<T>>;
 
+    template <typename T>
+    using TriviallyMoveAssignable = std::is_trivially_move_assignable<T>;
+
+    template <typename T>
+    using VoidOrTriviallyMoveAssignable = Or<IsVoid<T>, TriviallyMoveAssignable<T>>;
+
     template <typename T>
     using Swappable = std::is_swappable<T>;
 
@@ -137,9 +176,18 @@ namespace stdx::details {
     template <typename From, typename To>
     using Convertible = std::is_convertible<From, To>;
 
+    template <typename F, typename... Ts>
+    using NothrowInvocable = std::is_nothrow_invocable<F, Ts...>;
+
     template <typename Condition, typename T1, typename T2>
     using Conditional = std::conditional_t<bool(Condition::value), T1, T2>;
 
+    // Whether storing U into an existing T cannot throw: T is assigned from U in place when it can be, otherwise a
+    // temporary T is built from U and move-assigned.
+    template <typename T, typename U>
+    struct NothrowAssignableThroughTemporary
+        : Conditional<Assignable<T&, U>, NothrowAssignable<T&, U>, And<NothrowConstructible<T, U>, NothrowMoveAssignable<T>>> {};
+
     template <typename T>
     using Cpp17Destructible = And<std::is_destructible<T>, std::is_object<T>, Not<std::is_array<T>>>;
 
@@ -149,6 +197,12 @@ namespace stdx::details {
     template <typename E>
     struct IsUnexpectedSpecialization<Unexpected<E>> : std::true_type {};
 
+    template <typename T>
+    struct IsExpectedSpecialization : std::false_type {};
+
+    template <typename T, typename E>
+    struct IsExpectedSpecialization<Expected<T, E>> : std::true_type {};
+
     template <typename E>
     using ValidUnexpectedSpecialization =
         And<std::is_object<E>, Not<std::is_array<E>>, Same<E, std::remove_cv_t<E>>, Not<IsUnexpectedSpecialization<E>>>;
@@ -159,4 +213,12 @@ namespace stdx::details {
                And<Cpp17Destructible<T>, Not<Or<Same<std::in_place_t, K>, Same<unexpect_t, K>, IsUnexpectedSpecialization<K>>>>>,
             Cpp17Destructible<E>,
             ValidUnexpectedSpecialization<E>>;
+
+    // Expected<T&, E> stores a pointer to T, so T only has to be an object type.
+    template <typename T, typename E>
+    using ValidExpectedReferenceSpecialization = And<
+        std::is_object<T>,
+        Not<IsUnexpectedSpecialization<std::remove_cv_t<T>>>,
+        Cpp17Destructible<E>,
+        ValidUnexpectedSpecialization<E>>;
 }
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+
+#include "Traits.hpp"
+
+namespace stdx::details {
+    // How uses-allocator construction ([allocator.uses.construction]) builds an X from Ts with an allocator A.
+    enum class EAllocatorConvention { None, Ignored, Leading, Trailing };
+
+    template <typename X, typename A, typename... Ts>
+    constexpr EAllocatorConvention SelectAllocatorConvention() noexcept {
+        if constexpr (!std::uses_allocator<X, A>::value) {
+            return Constructible<X, Ts...>() ? EAllocatorConvention::Ignored : EAllocatorConvention::None;
+        } else if constexpr (Constructible<X, std::allocator_arg_t, const A&, Ts...>()) {
+            return EAllocatorConvention::Leading;
+        } else if constexpr (Constructible<X, Ts..., const A&>()) {
+            return EAllocatorConvention::Trailing;
+        } else {
+            return EAllocatorConvention::None;
+        }
+    }
+
+    template <typename X, typename A, typename... Ts>
+    using UsesAllocatorConstructible = BoolConstant<SelectAllocatorConvention<X, A, Ts...>() != EAllocatorConvention::None>;
+
+    // C++17 has no std::make_obj_using_allocator. The result is a prvalue, so whatever it initializes is built in place.
+    template <typename X, typename A, typename... Ts>
+    constexpr X MakeUsingAllocator(const A& Alloc, Ts&&... Args) {
+        constexpr EAllocatorConvention Convention = SelectAllocatorConvention<X, A, Ts...>();
+        static_assert(Convention != EAllocatorConvention::None, "the alternative cannot be built from these arguments");
+
+        if constexpr (Convention == EAllocatorConvention::Ignored) {
+            return X(std::forward<Ts>(Args)...);
+        } else if constexpr (Convention == EAllocatorConvention::Leading) {
+            return X(std::allocator_arg, Alloc, std::forward<Ts>(Args)...);
+        } else {
+            return X(std::forward<Ts>(Args)..., Alloc);
+        }
+    }
+
+    // Allocator-aware types whose allocators can differ, so that it matters which one an object is built with.
+    template <typename X, typename = std::void_t<>>
+    struct HasStatefulAllocator : std::false_type {};
+
+    template <typename X>
+    struct HasStatefulAllocator<X, std::void_t<typename X::allocator_type, decltype(std::declval<const X&>().get_allocator())>> :
+        Not<typename std::allocator_traits<typename X::allocator_type>::is_always_equal> {};
+
+    template <bool, typename From, typename To, typename... Ts>
+    struct PropagatesAllocatorImpl : std::false_type {};
+
+    template <typename From, typename To, typename... Ts>
+    struct PropagatesAllocatorImpl<true, From, To, Ts...> :
+        And<std::uses_allocator<To, typename From::allocator_type>,
+            UsesAllocatorConstructible<To, typename From::allocator_type, Ts...>,
+            NothrowMoveConstructible<To>> {};
+
+    // An alternative of type To built from Ts to replace one of type From gets the allocator From holds, when that
+    // allocator has state (a std::pmr resource, an arena) and To can use it. It is built aside and moved in, which keeps
+    // the allocator and cannot throw, so the replacement stays as safe as it was.
+    template <typename From, typename To, typename... Ts>
+    using PropagatesAllocator = PropagatesAllocatorImpl<HasStatefulAllocator<From>::value, From, To, Ts...>;
+}
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include <Expected/Config.hpp>
+#include <Expected/Tags.hpp>
+
+// Error instrumentation is opt-in: define STDX_EXPECTED_ERROR_HOOKS in every translation unit (it changes the
+// signatures of the constructors below, so it must be consistent across the program). Without it none of this exists
+// and the constructors of Unexpected and Expected are exactly what they would be otherwise.
+//
+// With it, every error created counts once, with the place it was created at:
+//   - Unexpected(Error) and Unexpected<E>(std::in_place, ...);
+//   - Expected<T, E>(unexpect, ...).
+// Copies, conversions and propagation (combinators, co_await) carry an existing error on and are not counted again,
+// so the counts tell where errors originate. Counters are kept per thread and read with stdx::SnapshotErrorCounts().
+#if defined(STDX_EXPECTED_ERROR_HOOKS)
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__cpp_lib_source_location)
+#include <source_location>
+#endif
+
+#include "Details/Hash.hpp"
+
+namespace stdx {
+    // Where an error was created. File and Function point to string literals, and are null where the compiler offers
+    // neither std::source_location nor __builtin_FILE and friends.
+    struct ErrorSite {
+        const char* File = nullptr;
+        const char* Function = nullptr;
+        std::uint_least32_t Line = 0;
+    };
+
+    // How many errors of one type were created at one site since the program started, by all threads. Errors created
+    // past the capacity of a thread's table are counted under an empty Type and Site.
+    struct ErrorCount {
+        std::string Type;
+        ErrorSite Site;
+        std::uint64_t Count = 0;
+    };
+
+    // Called on every error created, after it has been counted, e.g. to sample or log them. Type is the name of E as
+    // the compiler spells it, e.g. "int" or "ns::ParseError", the same string as ErrorCount::Type.
+    using ErrorHook = void (*)(const char* Type, const ErrorSite& Site);
+}
+
+namespace stdx::details {
+    // Default arguments are evaluated at the call site, which is where these capture the location.
+#if defined(__cpp_lib_source_location)
+    constexpr ErrorSite CurrentErrorSite(std::source_location Where = std::source_location::current()) noexcept {
+        return ErrorSite{Where.file_name(), Where.function_name(), std::uint_least32_t(Where.line())};
+    }
+#elif defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1926)
+    constexpr ErrorSite CurrentErrorSite(
+        const char* File = __builtin_FILE(),
+        const char* Function = __builtin_FUNCTION(),
+        std::uint_least32_t Line = __builtin_LINE()) noexcept {
+        return ErrorSite{File, Function, Line};
+    }
+#else
+    constexpr ErrorSite CurrentErrorSite() noexcept {
+        return ErrorSite{};
+    }
+#endif
+
+    // Stands for a tag (unexpect, std::in_place) in the constructors that create an error. It is converted from the tag
+    // implicitly, and the default argument of that conversion is evaluated where the constructor is called.
+    template <typename Tag>
+    struct TrackedTag {
+        constexpr TrackedTag(Tag, ErrorSite Where = CurrentErrorSite()) noexcept : Site(Where) {}
+
+        ErrorSite Site;
+    };
+
+    using UnexpectTag = TrackedTag<unexpect_t>;
+    using InPlaceTag = TrackedTag<std::in_place_t>;
+
+    // The signature it returns names E.
+    template <typename E>
+    const char* ErrorTypeSignature() noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return __PRETTY_FUNCTION__;
+#elif defined(_MSC_VER)
+        return __FUNCSIG__;
+#else
+        return "";
+#endif
+    }
+
+    // Extracts E out of the signature of ErrorTypeSignature<E>, "... [with E = X]" (GCC), "... [E = X]" (Clang) or
+    // "...ErrorTypeSignature<X>(void)" (MSVC).
+    inline std::string ErrorTypeName(const std::string& Signature) {
+        if (const std::size_t Start = Signature.find("E = "); Start != std::string::npos) {
+            const std::size_t Stop = Signature.find_first_of(";]", Start);
+            return Signature.substr(Start + 4, Stop == std::string::npos ? std::string::npos : Stop - Start - 4);
+        }
+        if (const std::size_t Start = Signature.find("ErrorTypeSignature<"); Start != std::string::npos) {
+            const std::size_t Stop = Signature.rfind(">(");
+            return Signature.substr(Start + 19, Stop == std::string::npos ? std::string::npos : Stop - Start - 19);
+        }
+        return Signature;
+    }
+
+    // Its address identifies E, and it returns the name of E, extracted on the first call.
+    template <typename E>
+    const char* ErrorTypeNameOf() noexcept {
+        static const std::string Name = ErrorTypeName(ErrorTypeSignature<E>());
+        return Name.c_str();
+    }
+
+    using ErrorTypeKey = const char* (*)() noexcept;
+
+    struct ErrorSlot {
+        std::atomic<ErrorTypeKey> Type{nullptr};
+        std::atomic<const char*> File{nullptr};
+        std::atomic<const char*> Function{nullptr};
+        std::atomic<std::uint_least32_t> Line{0};
+        std::atomic<std::uint64_t> Count{0};
+    };
+
+    // An open-addressed table of counters, keyed by the error type and the site. A single thread at a time claims
+    // slots and counts, so neither takes a read-modify-write; others only read, to take a snapshot. A slot is
+    // published by the release store of its type, after its site.
+    struct ErrorTable {
+        static constexpr std::size_t Capacity = 128;
+
+        void Add(ErrorTypeKey Type, const ErrorSite& Site, std::uint64_t Count) noexcept {
+            ErrorSlot& Slot = Claim(Type, Site);
+            Slot.Count.store(Slot.Count.load(std::memory_order_relaxed) + Count, std::memory_order_relaxed);
+        }
+
+        template <typename F>
+        void ForEach(F&& Func) const {
+            for (const ErrorSlot& Slot : Slots) {
+                if (const ErrorTypeKey Type = Slot.Type.load(std::memory_order_acquire)) {
+                    const ErrorSite Site{
+                        Slot.File.load(std::memory_order_relaxed),
+                        Slot.Function.load(std::memory_order_relaxed),
+                        Slot.Line.load(std::memory_order_relaxed)};
+                    Func(Type, Site, Slot.Count.load(std::memory_order_relaxed));
+                }
+            }
+            if (const std::uint64_t Count = Overflow.Count.load(std::memory_order_relaxed)) {
+                Func(nullptr, ErrorSite{}, Count);
+            }
+        }
+
+    private:
+        [[nodiscard]] ErrorSlot& Claim(ErrorTypeKey Type, const ErrorSite& Site) noexcept {
+            std::size_t Index = MixHash(CombineHash(
+                CombineHash(reinterpret_cast<std::uintptr_t>(Type), reinterpret_cast<std::uintptr_t>(Site.File)),
+                Site.Line));
+            for (std::size_t Probe = 0; Probe < Capacity; ++Probe, ++Index) {
+                ErrorSlot& Slot = Slots[Index % Capacity];
+                const ErrorTypeKey Claimed = Slot.Type.load(std::memory_order_relaxed);
+                if (Claimed == nullptr) {
+                    Slot.File.store(Site.File, std::memory_order_relaxed);
+                    Slot.Function.store(Site.Function, std::memory_order_relaxed);
+                    Slot.Line.store(Site.Line, std::memory_order_relaxed);
+                    Slot.Type.store(Type, std::memory_order_release);
+                    return Slot;
+                }
+                if (Claimed == Type && Slot.File.load(std::memory_order_relaxed) == Site.File &&
+                    Slot.Line.load(std::memory_order_relaxed) == Site.Line) {
+                    return Slot;
+                }
+            }
+            return Overflow;
+        }
+
+        ErrorSlot Slots[Capacity];
+        ErrorSlot Overflow;
+    };
+
+    struct ThreadErrorTable;
+
+    // The tables of the running threads, and what the finished ones counted.
+    struct ErrorRegistry {
+        [[nodiscard]] static ErrorRegistry& Get() noexcept {
+            static ErrorRegistry Registry;
+            return Registry;
+        }
+
+        std::mutex Mutex;
+        ThreadErrorTable* Threads = nullptr;
+        ErrorTable Retired;
+    };
+
+    // Registers itself on the first error a thread creates, and hands its counts over to the registry when it exits.
+    struct ThreadErrorTable : ErrorTable {
+        ThreadErrorTable() noexcept {
+            ErrorRegistry& Registry = ErrorRegistry::Get();
+            std::lock_guard<std::mutex> Lock(Registry.Mutex);
+            Next = Registry.Threads;
+            if (Next != nullptr) {
+                Next->Previous = this;
+            }
+            Registry.Threads = this;
+        }
+
+        ThreadErrorTable(const ThreadErrorTable&) = delete;
+        ThreadErrorTable& operator=(const ThreadErrorTable&) = delete;
+
+        ~ThreadErrorTable() {
+            ErrorRegistry& Registry = ErrorRegistry::Get();
+            std::lock_guard<std::mutex> Lock(Registry.Mutex);
+            ForEach([&](ErrorTypeKey Type, const ErrorSite& Site, std::uint64_t Count) noexcept {
+                Registry.Retired.Add(Type, Site, Count);
+            });
+            (Previous != nullptr ? Previous->Next : Registry.Threads) = Next;
+            if (Next != nullptr) {
+                Next->Previous = Previous;
+            }
+        }
+
+        ThreadErrorTable* Previous = nullptr;
+        ThreadErrorTable* Next = nullptr;
+    };
+
+    inline std::atomic<ErrorHook> GlobalErrorHook = nullptr;
+
+    inline void RecordError(ErrorTypeKey Type, const ErrorSite& Site) noexcept {
+        static thread_local ThreadErrorTable Table;
+        Table.Add(Type, Site, 1);
+        if (ErrorHook Hook = GlobalErrorHook.load(std::memory_order_acquire)) {
+            Hook(Type(), Site);
+        }
+    }
+}
+
+namespace stdx {
+    // Installs a hook called on every error created. Returns the previously installed hook.
+    inline ErrorHook SetErrorHook(ErrorHook Hook) noexcept {
+        return details::GlobalErrorHook.exchange(Hook, std::memory_order_acq_rel);
+    }
+
+    // Sums the counters of all threads, running or finished. The counts of a running thread are read while it may be
+    // updating them, so each is exact as of some moment during the call, not all as of the same one.
+    inline std::vector<ErrorCount> SnapshotErrorCounts() {
+        std::vector<ErrorCount> Counts;
+        std::vector<details::ErrorTypeKey> Types;
+        auto Accumulate = [&](details::ErrorTypeKey Type, const ErrorSite& Site, std::uint64_t Count) {
+            // A header included by several translation units may leave a copy of the same file name in each.
+            auto Same = [](const char* X, const char* Y) {
+                return X == Y || (X != nullptr && Y != nullptr && std::strcmp(X, Y) == 0);
+            };
+            for (std::size_t I = 0; I < Counts.size(); ++I) {
+                if (Types[I] == Type && Counts[I].Site.Line == Site.Line && Same(Counts[I].Site.File, Site.File) &&
+                    Same(Counts[I].Site.Function, Site.Function)) {
+                    Counts[I].Count += Count;
+                    return;
+                }
+            }
+            Types.push_back(Type);
+            Counts.push_back(ErrorCount{Type != nullptr ? std::string(Type()) : std::string(), Site, Count});
+        };
+
+        details::ErrorRegistry& Registry = details::ErrorRegistry::Get();
+        std::lock_guard<std::mutex> Lock(Registry.Mutex);
+        for (const details::ThreadErrorTable* Table = Registry.Threads; Table != nullptr; Table = Table->Next) {
+            Table->ForEach(Accumulate);
+        }
+        Registry.Retired.ForEach(Accumulate);
+        return Counts;
+    }
+}
+
+#define _EXPECTED_ERROR_SITE_PARAMETER , ::stdx::ErrorSite Site = ::stdx::details::CurrentErrorSite()
+#define _EXPECTED_RECORD_ERROR(E, Where)                                                                                     \
+    do {                                                                                                                         \
+        if (!_EXPECTED_IS_CONSTANT_EVALUATED()) {                                                                                \
+            ::stdx::details::RecordError(&::stdx::details::ErrorTypeNameOf<E>, Where);                                           \
+        }                                                                                                                        \
+    } while (false)
+#define _EXPECTED_RECORD_ERROR_AT(E, Tag) _EXPECTED_RECORD_ERROR(E, Tag.Site)
+#else
+namespace stdx::details {
+    using UnexpectTag = unexpect_t;
+    using InPlaceTag = std::in_place_t;
+}
+
+#define _EXPECTED_ERROR_SITE_PARAMETER
+#define _EXPECTED_RECORD_ERROR(E, Where) static_cast<void>(0)
+#define _EXPECTED_RECORD_ERROR_AT(E, Tag) static_cast<void>(Tag)
+#endif
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Details/BaseExpected.hpp"
+#include "Details/ExpectedLayout.hpp"
 
 namespace stdx {
     template <typename T, typename E>
@@ -12,6 +13,25 @@ namespace stdx {
         static constexpr auto WithValue = std::in_place_index<0>;
         static constexpr auto WithError = std::in_place_index<1>;
 
+        friend struct details::ExpectedCombinators;
+
+        template <std::size_t I, typename F, typename... Ts>
+        constexpr Expected(details::in_place_invoke_t, std::in_place_index_t<I> Index, F && Func, Ts && ... Args) noexcept(
+            details::NothrowInvocable<F, Ts...>()) :
+            Super(Index, details::in_place_invoke, std::forward<F>(Func), std::forward<Ts>(Args)...) {}
+
+        template <typename A, typename Self>
+        void ConstructUsing(const A& Alloc, Self&& Other) {
+            if (Other.HasValue()) {
+                if constexpr (!details::IsVoid<T>()) {
+                    Super::ConstructValueUsing(Alloc, *std::forward<Self>(Other));
+                }
+            } else {
+                Super::ConstructUnexpectedUsing(Alloc, std::forward<Self>(Other).Error());
+            }
+            Super::SetHasValue(Other.HasValue());
+        }
+
     public:
         template <typename U>
         using Rebind = Expected<U, E>;
@@ -24,7 +44,7 @@ namespace stdx {
             typename G,
             typename _Traits = details::CopyConstructibleFromExpected<T, E, U, G>,
             typename std::enable_if_t<_Traits::Implicit, int> = 0>
-        Expected(const Expected<U, G>& Other) noexcept(_Traits::Nothrow) {
+        _EXPECTED_CONSTEXPR20 Expected(const Expected<U, G>& Other) noexcept(_Traits::Nothrow) {
             if (Other.HasValue()) {
                 if constexpr (!details::IsVoid<T>()) {
                     Super::ConstructValue(*Other);
@@ -32,7 +52,7 @@ namespace stdx {
             } else {
                 Super::ConstructUnexpected(Other.Error());
             }
-            Super::bHasValue = Other.HasValue();
+            Super::SetHasValue(Other.HasValue());
         }
 
         template <
@@ -40,7 +60,7 @@ namespace stdx {
             typename G,
             typename _Traits = details::CopyConstructibleFromExpected<T, E, U, G>,
             typename std::enable_if_t<_Traits::Explicit, int> = 0>
-        explicit Expected(const Expected<U, G>& Other) noexcept(_Traits::Nothrow) {
+        _EXPECTED_CONSTEXPR20 explicit Expected(const Expected<U, G>& Other) noexcept(_Traits::Nothrow) {
             if (Other.HasValue()) {
                 if constexpr (!details::IsVoid<T>()) {
                     Super::ConstructValue(*Other);
@@ -48,7 +68,7 @@ namespace stdx {
             } else {
                 Super::ConstructUnexpected(Other.Error());
             }
-            Super::bHasValue = Other.HasValue();
+            Super::SetHasValue(Other.HasValue());
         }
 
         template <
@@ -56,7 +76,7 @@ namespace stdx {
             typename G,
             typename _Traits = details::MoveConstructibleFromExpected<T, E, U, G>,
             typename std::enable_if_t<_Traits::Implicit, int> = 0>
-        Expected(Expected<U, G> && Other) noexcept(_Traits::Nothrow) {
+        _EXPECTED_CONSTEXPR20 Expected(Expected<U, G> && Other) noexcept(_Traits::Nothrow) {
             if (Other.HasValue()) {
                 if constexpr (!details::IsVoid<T>()) {
                     Super::ConstructValue(std::move(*Other));
@@ -64,7 +84,7 @@ namespace stdx {
             } else {
                 Super::ConstructUnexpected(std::move(Other).Error());
             }
-            Super::bHasValue = Other.HasValue();
+            Super::SetHasValue(Other.HasValue());
         }
 
         template <
@@ -72,7 +92,7 @@ namespace stdx {
             typename G,
             typename _Traits = details::MoveConstructibleFromExpected<T, E, U, G>,
             typename std::enable_if_t<_Traits::Explicit, int> = 0>
-        explicit Expected(Expected<U, G> && Other) noexcept(_Traits::Nothrow) {
+        _EXPECTED_CONSTEXPR20 explicit Expected(Expected<U, G> && Other) noexcept(_Traits::Nothrow) {
             if (Other.HasValue()) {
                 if constexpr (!details::IsVoid<T>()) {
                     Super::ConstructValue(std::move(*Other));
@@ -80,7 +100,7 @@ namespace stdx {
             } else {
                 Super::ConstructUnexpected(std::move(Other.Error()));
             }
-            Super::bHasValue = Other.HasValue();
+            Super::SetHasValue(Other.HasValue());
         }
 
         template <
@@ -132,16 +152,106 @@ namespace stdx {
             Super(WithValue, List, std::forward<Ts>(Args)...) {}
 
         template <typename... Ts, typename std::enable_if_t<details::Constructible<E, Ts...>::value, int> = 0>
-        constexpr explicit Expected(unexpect_t, Ts && ... Args) noexcept(details::NothrowConstructible<E, Ts...>()) :
-            Super(WithError, std::in_place, std::forward<Ts>(Args)...) {}
+        constexpr explicit Expected(details::UnexpectTag Tag, Ts && ... Args) noexcept(
+            details::NothrowConstructible<E, Ts...>()) :
+            Super(WithError, std::forward<Ts>(Args)...) {
+            _EXPECTED_RECORD_ERROR_AT(E, Tag);
+        }
 
         template <
             typename U,
             typename... Ts,
             typename std::enable_if_t<details::Constructible<E, std::initializer_list<U>&, Ts...>::value, int> = 0>
-        constexpr explicit Expected(unexpect_t, std::initializer_list<U> List, Ts && ... Args) noexcept(
+        constexpr explicit Expected(details::UnexpectTag Tag, std::initializer_list<U> List, Ts && ... Args) noexcept(
             details::NothrowConstructible<E, std::initializer_list<U>&, Ts...>()) :
-            Super(WithError, std::in_place, List, std::forward<Ts>(Args)...) {}
+            Super(WithError, List, std::forward<Ts>(Args)...) {
+            _EXPECTED_RECORD_ERROR_AT(E, Tag);
+        }
+
+        // Takes on an error that was already counted, see details::untracked_t.
+        template <typename... Ts, typename std::enable_if_t<details::Constructible<E, Ts...>::value, int> = 0>
+        constexpr explicit Expected(details::untracked_t, Ts && ... Args) noexcept(details::NothrowConstructible<E, Ts...>()) :
+            Super(WithError, std::forward<Ts>(Args)...) {}
+
+        /*
+         * Allocator-extended constructors: the alternative is built by uses-allocator construction with Alloc, so that
+         * an Expected holding std::pmr containers takes the memory resource it is given instead of the default one. They
+         * are what std::pmr containers of Expected call, see the std::uses_allocator specialization below.
+         */
+
+        template <
+            typename A,
+            typename U = T,
+            typename std::enable_if_t<details::Or<details::IsVoid<U>, details::UsesAllocatorConstructible<U, A>>::value, int> = 0>
+        Expected(std::allocator_arg_t, const A& Alloc) {
+            if constexpr (!details::IsVoid<T>()) {
+                Super::ConstructValueUsing(Alloc);
+            }
+            Super::SetHasValue(true);
+        }
+
+        template <
+            typename A,
+            typename... Ts,
+            typename std::enable_if_t<details::UsesAllocatorConstructible<T, A, Ts...>::value, int> = 0>
+        Expected(std::allocator_arg_t, const A& Alloc, std::in_place_t, Ts&&... Args) {
+            Super::ConstructValueUsing(Alloc, std::forward<Ts>(Args)...);
+            Super::SetHasValue(true);
+        }
+
+        template <
+            typename A,
+            typename... Ts,
+            typename std::enable_if_t<details::UsesAllocatorConstructible<E, A, Ts...>::value, int> = 0>
+        Expected(std::allocator_arg_t, const A& Alloc, details::UnexpectTag Tag, Ts&&... Args) {
+            Super::ConstructUnexpectedUsing(Alloc, std::forward<Ts>(Args)...);
+            Super::SetHasValue(false);
+            _EXPECTED_RECORD_ERROR_AT(E, Tag);
+        }
+
+        template <
+            typename A,
+            typename U,
+            typename std::enable_if_t<
+                details::And<
+                    details::Not<details::Same<details::RemoveCVRef<U>, Expected>>,
+                    details::Not<details::Same<details::RemoveCVRef<U>, std::in_place_t>>,
+                    details::Not<details::Same<details::RemoveCVRef<U>, unexpect_t>>,
+                    details::Not<details::IsUnexpectedSpecialization<details::RemoveCVRef<U>>>,
+                    details::UsesAllocatorConstructible<T, A, U>>::value,
+                int> = 0>
+        Expected(std::allocator_arg_t, const A& Alloc, U&& Value) {
+            Super::ConstructValueUsing(Alloc, std::forward<U>(Value));
+            Super::SetHasValue(true);
+        }
+
+        template <
+            typename A,
+            typename G,
+            typename std::enable_if_t<details::UsesAllocatorConstructible<E, A, const G&>::value, int> = 0>
+        Expected(std::allocator_arg_t, const A& Alloc, const Unexpected<G>& Unex) {
+            Super::ConstructUnexpectedUsing(Alloc, Unex.Value());
+            Super::SetHasValue(false);
+        }
+
+        template <
+            typename A,
+            typename G,
+            typename std::enable_if_t<details::UsesAllocatorConstructible<E, A, G&&>::value, int> = 0>
+        Expected(std::allocator_arg_t, const A& Alloc, Unexpected<G>&& Unex) {
+            Super::ConstructUnexpectedUsing(Alloc, std::move(Unex).Value());
+            Super::SetHasValue(false);
+        }
+
+        template <typename A>
+        Expected(std::allocator_arg_t, const A& Alloc, const Expected& Other) {
+            ConstructUsing(Alloc, Other);
+        }
+
+        template <typename A>
+        Expected(std::allocator_arg_t, const A& Alloc, Expected&& Other) {
+            ConstructUsing(Alloc, std::move(Other));
+        }
 
         template <
             typename G = E,
@@ -150,17 +260,21 @@ namespace stdx {
                     details::Or<details::IsVoid<T>, details::NothrowConstructible<E, const G&>>,
                     details::MoveAssignable<E>>::value,
                 int> = 0>
-        Expected& operator=(const Unexpected<G>& Unex) noexcept(
-            details::NothrowConstructible<E, const G&>() && details::NothrowMoveAssignable<E>()) {
+        _EXPECTED_CONSTEXPR20 Expected& operator=(const Unexpected<G>& Unex) noexcept(
+            details::NothrowConstructible<E, const G&>() && details::NothrowAssignableThroughTemporary<E, const G&>()) {
             if (Super::HasValue()) {
-                if constexpr (!details::IsVoid<T>()) {
-                    Super::DestroyValue();
+                if constexpr (details::PropagatesAllocator<T, E, const G&>()) {
+                    Super::PropagateIntoUnexpected(Unex.Value());
+                } else {
+                    if constexpr (!details::IsVoid<T>()) {
+                        Super::DestroyValue();
+                    }
+                    Super::ConstructUnexpected(Unex.Value());
                 }
-                Super::ConstructUnexpected(Unex.Value());
             } else {
-                Super::AssignUnexpected(Unexpected<E>(Unex.Value()));
+                Super::AssignUnexpected(Unex.Value());
             }
-            Super::bHasValue = false;
+            Super::SetHasValue(false);
             return *this;
         }
 
@@ -170,17 +284,21 @@ namespace stdx {
                 details::And<details::Or<details::IsVoid<T>, details::NothrowConstructible<E, G&&>>, details::MoveAssignable<E>>::
                     value,
                 int> = 0>
-        Expected& operator=(Unexpected<G>&& Unex) noexcept(
-            details::NothrowConstructible<E, G&&>() && details::NothrowMoveAssignable<E>()) {
+        _EXPECTED_CONSTEXPR20 Expected& operator=(Unexpected<G>&& Unex) noexcept(
+            details::NothrowConstructible<E, G&&>() && details::NothrowAssignableThroughTemporary<E, G&&>()) {
             if (Super::HasValue()) {
-                if constexpr (!details::IsVoid<T>()) {
-                    Super::DestroyValue();
+                if constexpr (details::PropagatesAllocator<T, E, G&&>()) {
+                    Super::PropagateIntoUnexpected(std::move(Unex).Value());
+                } else {
+                    if constexpr (!details::IsVoid<T>()) {
+                        Super::DestroyValue();
+                    }
+                    Super::ConstructUnexpected(std::move(Unex).Value());
                 }
-                Super::ConstructUnexpected(std::move(Unex).Value());
             } else {
-                Super::AssignUnexpected(Unexpected<E>(std::move(Unex).Value()));
+                Super::AssignUnexpected(std::move(Unex).Value());
             }
-            Super::bHasValue = false;
+            Super::SetHasValue(false);
             return *this;
         }
 
@@ -188,35 +306,46 @@ namespace stdx {
             typename U = T,
             typename std::
                 enable_if_t<details::And<details::Not<details::IsVoid<T>>, details::AssignableFromU<T, E, U>>::value, int> = 0>
-        Expected& operator=(U&& Value) noexcept(details::NothrowConstructible<T, U>() && details::NothrowAssignable<T&, U>()) {
+        _EXPECTED_CONSTEXPR20 Expected& operator=(U&& Value) noexcept(
+            details::NothrowConstructible<T, U>() && details::NothrowAssignable<T&, U>()) {
             if (Super::HasValue()) {
                 Super::AssignValue(std::forward<U>(Value));
             } else {
-                if constexpr (details::NothrowConstructible<T, U>()) {
+                if constexpr (details::PropagatesAllocator<E, T, U>()) {
+                    Super::PropagateIntoValue(std::forward<U>(Value));
+                } else if constexpr (details::NothrowOrNoExceptions<details::NothrowConstructible<T, U>>()) {
                     Super::DestroyUnexpected();
                     Super::ConstructValue(std::forward<U>(Value));
                 } else {
-                    Unexpected<E> Tmp(std::move(Super::Error()));
+                    E Tmp(std::move(Super::Error()));
                     Super::DestroyUnexpected();
-                    try {
+                    _EXPECTED_TRY {
                         Super::ConstructValue(std::forward<U>(Value));
-                    } catch (...) {
-                        Super::ConstructUnexpected(std::move(Tmp));
-                        throw;
+                    }
+                    _EXPECTED_CATCH_ALL {
+                        Super::RestoreUnexpected(std::move(Tmp));
+                        _EXPECTED_RETHROW;
                     }
                 }
             }
-            Super::bHasValue = true;
+            Super::SetHasValue(true);
             return *this;
         }
 
-        void Swap(Expected<T, E> & Other) noexcept(details::And<
-                                                   details::VoidOrNothrowMoveConstructible<T>,
-                                                   details::VoidOrNothrowSwappable<T>,
-                                                   details::NothrowMoveConstructible<E>,
-                                                   details::NothrowSwappable<E>>()) {
+        _EXPECTED_CONSTEXPR20 void Swap(Expected<T, E> & Other) noexcept(details::And<
+                                                                         details::VoidOrNothrowMoveConstructible<T>,
+                                                                         details::VoidOrNothrowSwappable<T>,
+                                                                         details::NothrowMoveConstructible<E>,
+                                                                         details::NothrowSwappable<E>>()) {
             using std::swap;
 
+            if constexpr (details::TriviallyRelocatableAlternatives<T, E>()) {
+                if (!_EXPECTED_CONSTEXPR20_EVALUATED()) {
+                    Super::SwapBytes(Other);
+                    return;
+                }
+            }
+
             if (Other.HasValue()) {
                 if (Super::HasValue()) {
                     if constexpr (!details::IsVoid<T>()) {
@@ -230,38 +359,43 @@ namespace stdx {
                     if constexpr (details::IsVoid<T>()) {
                         Super::ConstructUnexpected(std::move(Other).Error());
                         Other.DestroyUnexpected();
-                    } else if constexpr (details::NothrowMoveConstructible<T>() && details::NothrowMoveConstructible<E>()) {
-                        Unexpected<E> Tmp(std::move(Other).Error());
+                    } else if constexpr (details::NothrowOrNoExceptions<details::And<
+                                             details::NothrowMoveConstructible<T>,
+                                             details::NothrowMoveConstructible<E>>>()) {
+                        E Tmp(std::move(Other).Error());
                         Other.DestroyUnexpected();
                         Other.ConstructValue(std::move(**this));
                         Super::DestroyValue();
                         Super::ConstructUnexpected(std::move(Tmp));
                     } else if constexpr (details::NothrowMoveConstructible<E>()) {
-                        Unexpected<E> Tmp(std::move(Other).Error());
+                        E Tmp(std::move(Other).Error());
                         Other.DestroyUnexpected();
-                        try {
+                        _EXPECTED_TRY {
                             Other.ConstructValue(std::move(**this));
-                        } catch (...) {
-                            Other.ConstructUnexpected(std::move(Tmp));
-                            throw;
+                        }
+                        _EXPECTED_CATCH_ALL {
+                            Other.RestoreUnexpected(std::move(Tmp));
+                            _EXPECTED_RETHROW;
                         }
                         Super::DestroyValue();
                         Super::ConstructUnexpected(std::move(Tmp));
                     } else if constexpr (details::NothrowMoveConstructible<T>()) {
                         T Tmp(std::move(**this));
                         Super::DestroyValue();
-                        try {
+                        _EXPECTED_TRY {
                             Super::ConstructUnexpected(std::move(Other).Error());
-                        } catch (...) {
-                            Super::ConstructValue(std::move(Tmp));
-                            throw;
+                        }
+                        _EXPECTED_CATCH_ALL {
+                            Super::RestoreValue(std::move(Tmp));
+                            _EXPECTED_RETHROW;
                         }
                         Other.DestroyUnexpected();
                         Other.ConstructValue(std::move(Tmp));
                     } else {
                         static_assert(sizeof(T) + sizeof(E) == 0);
                     }
-                    swap(Super::bHasValue, Other.bHasValue);
+                    Super::SetHasValue(false);
+                    Other.SetHasValue(true);
                 } else {
                     swap(Super::Error(), Other.Error());
                 }
@@ -269,6 +403,195 @@ namespace stdx {
         }
     };
 
+    // Holds a reference to a T or an E. Only lvalues are bound to, and assignment rebinds the reference instead of
+    // assigning through it, like assigning a pointer. Comparisons compare the referent.
+    template <typename T, typename E>
+    class [[nodiscard]] Expected<T&, E> final : public details::BaseExpected<T&, E> {
+        static_assert(details::ValidExpectedReferenceSpecialization<T, E>());
+
+        using Super = details::BaseExpected<T&, E>;
+
+        static constexpr auto WithValue = std::in_place_index<0>;
+        static constexpr auto WithError = std::in_place_index<1>;
+
+        friend struct details::ExpectedCombinators;
+
+        template <typename F, typename... Ts>
+        constexpr Expected(details::in_place_invoke_t, std::in_place_index_t<0>, F && Func, Ts && ... Args) noexcept(
+            details::NothrowInvocable<F, Ts...>()) :
+            Super(WithValue, std::addressof(std::invoke(std::forward<F>(Func), std::forward<Ts>(Args)...))) {}
+
+        template <typename F, typename... Ts>
+        constexpr Expected(details::in_place_invoke_t, std::in_place_index_t<1> Index, F && Func, Ts && ... Args) noexcept(
+            details::NothrowInvocable<F, Ts...>()) :
+            Super(Index, details::in_place_invoke, std::forward<F>(Func), std::forward<Ts>(Args)...) {}
+
+    public:
+        template <typename U>
+        using Rebind = Expected<U, E>;
+
+        template <
+            typename U,
+            typename G,
+            typename _Traits = details::CopyConstructibleFromReference<T, E, U, G>,
+            typename std::enable_if_t<_Traits::Implicit, int> = 0>
+        _EXPECTED_CONSTEXPR20 Expected(const Expected<U&, G>& Other) noexcept(_Traits::Nothrow) {
+            if (Other.HasValue()) {
+                Super::ConstructValue(std::addressof(*Other));
+            } else {
+                Super::ConstructUnexpected(Other.Error());
+            }
+            Super::SetHasValue(Other.HasValue());
+        }
+
+        template <
+            typename U,
+            typename G,
+            typename _Traits = details::CopyConstructibleFromReference<T, E, U, G>,
+            typename std::enable_if_t<_Traits::Explicit, int> = 0>
+        _EXPECTED_CONSTEXPR20 explicit Expected(const Expected<U&, G>& Other) noexcept(_Traits::Nothrow) {
+            if (Other.HasValue()) {
+                Super::ConstructValue(std::addressof(*Other));
+            } else {
+                Super::ConstructUnexpected(Other.Error());
+            }
+            Super::SetHasValue(Other.HasValue());
+        }
+
+        template <typename U, typename std::enable_if_t<details::BindsReference<T, U>::value, int> = 0>
+        constexpr Expected(U && Value) noexcept : Super(WithValue, std::addressof(Value)) {}
+
+        template <typename U, typename std::enable_if_t<details::BindsReference<T, U>::value, int> = 0>
+        constexpr explicit Expected(std::in_place_t, U && Value) noexcept : Super(WithValue, std::addressof(Value)) {}
+
+        template <
+            typename G = E,
+            typename std::enable_if_t<details::Constructible<E, const G&>() && details::Convertible<const G&, E>(), int> = 0>
+        constexpr Expected(const Unexpected<G>& Unex) noexcept(details::NothrowConstructible<E, const G&>()) :
+            Super(WithError, Unex.Value()) {}
+
+        template <
+            typename G = E,
+            typename std::enable_if_t<details::Constructible<E, const G&>() && !details::Convertible<const G&, E>(), int> = 0>
+        constexpr explicit Expected(const Unexpected<G>& Unex) noexcept(details::NothrowConstructible<E, const G&>()) :
+            Super(WithError, Unex.Value()) {}
+
+        template <
+            typename G = E,
+            typename std::enable_if_t<details::Constructible<E, G&&>() && details::Convertible<G&&, E>(), int> = 0>
+        constexpr Expected(Unexpected<G> && Unex) noexcept(details::NothrowConstructible<E, G&&>()) :
+            Super(WithError, std::move(Unex).Value()) {}
+
+        template <
+            typename G = E,
+            typename std::enable_if_t<details::Constructible<E, G&&>() && !details::Convertible<G&&, E>(), int> = 0>
+        constexpr explicit Expected(Unexpected<G> && Unex) noexcept(details::NothrowConstructible<E, G&&>()) :
+            Super(WithError, std::move(Unex).Value()) {}
+
+        template <typename... Ts, typename std::enable_if_t<details::Constructible<E, Ts...>::value, int> = 0>
+        constexpr explicit Expected(details::UnexpectTag Tag, Ts && ... Args) noexcept(
+            details::NothrowConstructible<E, Ts...>()) :
+            Super(WithError, std::forward<Ts>(Args)...) {
+            _EXPECTED_RECORD_ERROR_AT(E, Tag);
+        }
+
+        template <
+            typename U,
+            typename... Ts,
+            typename std::enable_if_t<details::Constructible<E, std::initializer_list<U>&, Ts...>::value, int> = 0>
+        constexpr explicit Expected(details::UnexpectTag Tag, std::initializer_list<U> List, Ts && ... Args) noexcept(
+            details::NothrowConstructible<E, std::initializer_list<U>&, Ts...>()) :
+            Super(WithError, List, std::forward<Ts>(Args)...) {
+            _EXPECTED_RECORD_ERROR_AT(E, Tag);
+        }
+
+        // Takes on an error that was already counted, see details::untracked_t.
+        template <typename... Ts, typename std::enable_if_t<details::Constructible<E, Ts...>::value, int> = 0>
+        constexpr explicit Expected(details::untracked_t, Ts && ... Args) noexcept(details::NothrowConstructible<E, Ts...>()) :
+            Super(WithError, std::forward<Ts>(Args)...) {}
+
+        template <
+            typename G = E,
+            typename std::enable_if_t<
+                details::And<details::Constructible<E, const G&>, details::MoveAssignable<E>>::value,
+                int> = 0>
+        _EXPECTED_CONSTEXPR20 Expected& operator=(const Unexpected<G>& Unex) noexcept(
+            details::NothrowConstructible<E, const G&>() && details::NothrowAssignableThroughTemporary<E, const G&>()) {
+            if (Super::HasValue()) {
+                DisplaceReferent(Unex.Value());
+            } else {
+                Super::AssignUnexpected(Unex.Value());
+            }
+            Super::SetHasValue(false);
+            return *this;
+        }
+
+        template <
+            typename G = E,
+            typename std::enable_if_t<details::And<details::Constructible<E, G&&>, details::MoveAssignable<E>>::value, int> = 0>
+        _EXPECTED_CONSTEXPR20 Expected& operator=(Unexpected<G>&& Unex) noexcept(
+            details::NothrowConstructible<E, G&&>() && details::NothrowAssignableThroughTemporary<E, G&&>()) {
+            if (Super::HasValue()) {
+                DisplaceReferent(std::move(Unex).Value());
+            } else {
+                Super::AssignUnexpected(std::move(Unex).Value());
+            }
+            Super::SetHasValue(false);
+            return *this;
+        }
+
+        template <typename U, typename std::enable_if_t<details::BindsReference<T, U>::value, int> = 0>
+        _EXPECTED_CONSTEXPR20 Expected& operator=(U&& Value) noexcept {
+            Super::Emplace(Value);
+            return *this;
+        }
+
+        _EXPECTED_CONSTEXPR20 void Swap(Expected<T&, E> & Other) noexcept(
+            details::And<details::NothrowMoveConstructible<E>, details::NothrowSwappable<E>>()) {
+            using std::swap;
+
+            if constexpr (details::TriviallyRelocatableAlternatives<T&, E>()) {
+                if (!_EXPECTED_CONSTEXPR20_EVALUATED()) {
+                    Super::SwapBytes(Other);
+                    return;
+                }
+            }
+
+            if (Other.HasValue()) {
+                if (Super::HasValue()) {
+                    swap(Super::Data.Value, Other.Data.Value);
+                } else {
+                    Other.Swap(*this);
+                }
+            } else {
+                if (Super::HasValue()) {
+                    T* Referent = Super::Data.Value;
+                    DisplaceReferent(std::move(Other).Error());
+                    Other.DestroyUnexpected();
+                    Other.ConstructValue(Referent);
+                    Super::SetHasValue(false);
+                    Other.SetHasValue(true);
+                } else {
+                    swap(Super::Error(), Other.Error());
+                }
+            }
+        }
+
+    private:
+        // The pointer is its own backup: it is put back if constructing the error in its place throws.
+        template <typename G>
+        _EXPECTED_CONSTEXPR20 void DisplaceReferent(G&& Error) {
+            T* Referent = Super::Data.Value;
+            _EXPECTED_TRY {
+                Super::ConstructUnexpected(std::forward<G>(Error));
+            }
+            _EXPECTED_CATCH_ALL {
+                Super::RestoreValue(Referent);
+                _EXPECTED_RETHROW;
+            }
+        }
+    };
+
     template <typename T1, typename E1, typename T2, typename E2>
     [[nodiscard]] constexpr bool operator==(const Expected<T1, E1>& X, const Expected<T2, E2>& Y) noexcept(
         noexcept(bool(*X == *Y) && bool(X.Error() == Y.Error()))) {
@@ -329,17 +652,106 @@ namespace stdx {
         return X != Unex;
     }
 
+    // Ordered like a std::variant<T, E>: every value sorts before every error, and Expected<void, E> values are equivalent.
+    template <typename T1, typename E1, typename T2, typename E2>
+    [[nodiscard]] constexpr bool operator<(const Expected<T1, E1>& X, const Expected<T2, E2>& Y) noexcept(
+        details::NothrowLessValues<T1, T2>() && noexcept(bool(X.Error() < Y.Error()))) {
+        if (X.HasValue() != Y.HasValue()) {
+            return X.HasValue();
+        }
+        if (X.HasValue()) {
+            if constexpr (details::IsVoid<T1>() && details::IsVoid<T2>()) {
+                return false;
+            } else {
+                return *X < *Y;
+            }
+        }
+        return X.Error() < Y.Error();
+    }
+
+    template <typename T1, typename E1, typename T2, typename E2>
+    [[nodiscard]] constexpr bool operator>(const Expected<T1, E1>& X, const Expected<T2, E2>& Y) noexcept(noexcept(Y < X)) {
+        return Y < X;
+    }
+
+    template <typename T1, typename E1, typename T2, typename E2>
+    [[nodiscard]] constexpr bool operator<=(const Expected<T1, E1>& X, const Expected<T2, E2>& Y) noexcept(noexcept(Y < X)) {
+        return !(Y < X);
+    }
+
+    template <typename T1, typename E1, typename T2, typename E2>
+    [[nodiscard]] constexpr bool operator>=(const Expected<T1, E1>& X, const Expected<T2, E2>& Y) noexcept(noexcept(X < Y)) {
+        return !(X < Y);
+    }
+
     template <
         typename T1,
         typename E1,
         typename std::enable_if_t<
             details::And<
-                details::Or<details::IsVoid<T1>, details::And<details::MoveConstructible<T1>, details::Swappable<T1>>>,
+                details::Or<
+                    details::IsVoid<T1>,
+                    details::IsLvalueReference<T1>,
+                    details::And<details::MoveConstructible<T1>, details::Swappable<T1>>>,
                 details::MoveConstructible<E1>,
                 details::Swappable<E1>,
                 details::Or<details::VoidOrNothrowMoveConstructible<T1>, details::NothrowMoveConstructible<E1>>>::value,
             int> = 0>
-    void swap(Expected<T1, E1>& X, Expected<T1, E1>& Y) noexcept(noexcept(X.Swap(Y))) {
+    _EXPECTED_CONSTEXPR20 void swap(Expected<T1, E1>& X, Expected<T1, E1>& Y) noexcept(noexcept(X.Swap(Y))) {
         return X.Swap(Y);
     }
+
+    // True for the specializations the layout policy guarantees to be trivially copyable, trivially destructible and
+    // no larger than two machine words, i.e. passed and returned in registers.
+    template <typename X>
+    struct IsRegisterPassable : std::false_type {};
+
+    // The guarantee is verified here rather than in Expected itself, where inspecting the layers would be paid for by
+    // every specialization. Or keeps them from being inspected at all when the policy does not apply.
+    template <typename T, typename E>
+    struct IsRegisterPassable<Expected<T, E>> : details::RegisterPassable<T, E> {
+        static_assert(
+            details::Or<details::Not<details::RegisterPassable<T, E>>, details::TrivialLayers<T, E>>(),
+            "a register-passable Expected must stay trivial through every layer of its special member chain");
+    };
+
+    template <typename T, typename E>
+    struct IsRegisterPassable<Expected<T&, E>> : IsRegisterPassable<Expected<T*, E>> {};
+
+    // Lets containers relocate an Expected with a memcpy, and Swap exchange two as bytes, when both alternatives allow it.
+    template <typename T, typename E>
+    struct IsTriviallyRelocatable<Expected<T, E>> : details::TriviallyRelocatableAlternatives<T, E> {};
+}
+
+namespace stdx::details {
+    template <typename T, typename E>
+    struct ExpectedHash {
+        std::size_t operator()(const Expected<T, E>& X) const {
+            if (!X.HasValue()) {
+                return CombineHash(0, std::hash<E>()(X.Error()));
+            }
+            if constexpr (IsVoid<T>()) {
+                return CombineHash(1, 0);
+            } else {
+                return CombineHash(1, std::hash<HashedType<T>>()(*X));
+            }
+        }
+    };
+}
+
+namespace std {
+    // Expected takes an allocator for whichever of its alternatives uses it, see its allocator-extended constructors.
+    template <typename T, typename E, typename A>
+    struct uses_allocator<stdx::Expected<T, E>, A> :
+        stdx::details::And<
+            stdx::details::Not<stdx::details::IsLvalueReference<T>>,
+            stdx::details::Or<uses_allocator<T, A>, uses_allocator<E, A>>> {};
+
+    // The alternative is mixed in, so that a value and an error with equal hashes do not collide.
+    template <typename T, typename E>
+    struct hash<stdx::Expected<T, E>> :
+        stdx::details::Conditional<
+            stdx::details::And<stdx::details::VoidOrHashable<T>, stdx::details::Hashable<E>>,
+            stdx::details::ExpectedHash<T, E>,
+            stdx::details::DisabledHash> {};
 }
\ No newline at end of file
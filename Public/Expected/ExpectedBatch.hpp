@@ -0,0 +1,281 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <Expected/Expected.hpp>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace stdx::details {
+    inline std::size_t PopCount(std::uint64_t Word) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return std::size_t(__builtin_popcountll(Word));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        return std::size_t(__popcnt64(Word));
+#else
+        std::size_t Count = 0;
+        for (; Word != 0; Word &= Word - 1) {
+            ++Count;
+        }
+        return Count;
+#endif
+    }
+
+    // A contiguous run of elements, as exposed by the columns of ExpectedBatch.
+    template <typename T>
+    class BatchColumn {
+    public:
+        constexpr BatchColumn(T* Data, std::size_t Size) noexcept : First(Data), Count(Size) {}
+
+        [[nodiscard]] constexpr T* begin() const noexcept {
+            return First;
+        }
+
+        [[nodiscard]] constexpr T* end() const noexcept {
+            return First + Count;
+        }
+
+        [[nodiscard]] constexpr T* Data() const noexcept {
+            return First;
+        }
+
+        [[nodiscard]] constexpr std::size_t Size() const noexcept {
+            return Count;
+        }
+
+        [[nodiscard]] constexpr bool Empty() const noexcept {
+            return Count == 0;
+        }
+
+        [[nodiscard]] constexpr T& operator[](std::size_t Index) const noexcept {
+            return First[Index];
+        }
+
+    private:
+        T* First;
+        std::size_t Count;
+    };
+
+    // Refers to one element of an ExpectedBatch with the interface of an Expected; the element can be modified in
+    // place but cannot switch between holding a value and holding an error.
+    template <typename T, typename E>
+    class BatchElement {
+    public:
+        using ValueType = T;
+        using ErrorType = E;
+
+        constexpr BatchElement(T* Value, E* Error) noexcept : ValuePtr(Value), ErrorPtr(Error) {}
+
+        [[nodiscard]] constexpr bool HasValue() const noexcept {
+            return ValuePtr != nullptr;
+        }
+
+        constexpr explicit operator bool() const noexcept {
+            return HasValue();
+        }
+
+        constexpr T& operator*() const noexcept {
+            return *ValuePtr;
+        }
+
+        constexpr T* operator->() const noexcept {
+            return ValuePtr;
+        }
+
+        constexpr T& Value() const {
+            if (_EXPECTED_UNLIKELY(!HasValue())) {
+                ThrowBadExpectedAccess(*ErrorPtr);
+            }
+            return *ValuePtr;
+        }
+
+        constexpr E& Error() const noexcept {
+            return *ErrorPtr;
+        }
+
+        template <typename U>
+        [[nodiscard]] constexpr std::remove_const_t<T> ValueOr(U&& Default) const {
+            return HasValue() ? *ValuePtr : static_cast<std::remove_const_t<T>>(std::forward<U>(Default));
+        }
+
+        operator Expected<std::remove_const_t<T>, std::remove_const_t<E>>() const {
+            if (HasValue()) {
+                return Expected<std::remove_const_t<T>, std::remove_const_t<E>>(std::in_place, *ValuePtr);
+            }
+            return Expected<std::remove_const_t<T>, std::remove_const_t<E>>(details::untracked, *ErrorPtr);
+        }
+
+    private:
+        T* ValuePtr;
+        E* ErrorPtr;
+    };
+}
+
+namespace stdx {
+    /*
+     * A sequence of Expected<T, E> results stored column-wise: the values, the errors and a validity bitmap are kept
+     * in three separate arrays instead of interleaving payloads and flags as std::vector<Expected<T, E>> does.
+     *
+     * Values and errors are packed: Values() is a contiguous array of every value in the batch, in order, which a
+     * consumer interested only in successes can scan (and the compiler can vectorize) without looking at the errors.
+     * The position of an element within its column is recovered from the bitmap, in constant time, by a population
+     * count over the current word on top of a running total kept per word.
+     *
+     * Elements are appended and may be modified in place afterwards, but an element cannot turn from a value into an
+     * error or back.
+     */
+    template <typename T, typename E>
+    class ExpectedBatch {
+        static_assert(!details::IsVoid<T>(), "ExpectedBatch<void, E> is not supported");
+        static_assert(
+            !details::Same<std::remove_cv_t<T>, bool>() && !details::Same<std::remove_cv_t<E>, bool>(),
+            "ExpectedBatch of bool is not supported: std::vector<bool> cannot hand out its elements as a column");
+
+        static constexpr std::size_t WordBits = 64;
+
+    public:
+        using ValueType = T;
+        using ErrorType = E;
+        using Reference = details::BatchElement<T, E>;
+        using ConstReference = details::BatchElement<const T, const E>;
+
+        ExpectedBatch() = default;
+
+        // Makes room for Capacity elements holding a value. The error column is left to grow on demand: reserving it as
+        // well would double the footprint of a batch in which errors are the exception.
+        void Reserve(std::size_t Capacity) {
+            ValueColumn.reserve(Capacity);
+            Words.reserve((Capacity + WordBits - 1) / WordBits);
+        }
+
+        void Clear() noexcept {
+            ValueColumn.clear();
+            ErrorColumn.clear();
+            Words.clear();
+            Count = 0;
+        }
+
+        template <typename... Ts>
+        T& EmplaceValue(Ts&&... Args) {
+            Grow();
+            T& Value = ValueColumn.emplace_back(std::forward<Ts>(Args)...);
+            Words.back().Bits |= std::uint64_t(1) << Count % WordBits;
+            ++Count;
+            return Value;
+        }
+
+        template <typename... Ts>
+        E& EmplaceError(Ts&&... Args) {
+            Grow();
+            E& Error = ErrorColumn.emplace_back(std::forward<Ts>(Args)...);
+            ++Count;
+            return Error;
+        }
+
+        void PushBack(const Expected<T, E>& X) {
+            if (X.HasValue()) {
+                EmplaceValue(*X);
+            } else {
+                EmplaceError(X.Error());
+            }
+        }
+
+        void PushBack(Expected<T, E>&& X) {
+            if (X.HasValue()) {
+                EmplaceValue(*std::move(X));
+            } else {
+                EmplaceError(std::move(X).Error());
+            }
+        }
+
+        [[nodiscard]] std::size_t Size() const noexcept {
+            return Count;
+        }
+
+        [[nodiscard]] bool Empty() const noexcept {
+            return Count == 0;
+        }
+
+        [[nodiscard]] std::size_t CountValues() const noexcept {
+            return ValueColumn.size();
+        }
+
+        [[nodiscard]] std::size_t CountErrors() const noexcept {
+            return ErrorColumn.size();
+        }
+
+        // Number of values among the first Index elements.
+        [[nodiscard]] std::size_t CountValues(std::size_t Index) const noexcept {
+            if (Index == Count) {
+                return ValueColumn.size();
+            }
+            const Word& Current = Words[Index / WordBits];
+            return Current.Rank + details::PopCount(Current.Bits & ((std::uint64_t(1) << Index % WordBits) - 1));
+        }
+
+        [[nodiscard]] bool HasValue(std::size_t Index) const noexcept {
+            return (Words[Index / WordBits].Bits >> Index % WordBits & 1) != 0;
+        }
+
+        [[nodiscard]] Reference operator[](std::size_t Index) noexcept {
+            std::size_t Rank = CountValues(Index);
+            if (HasValue(Index)) {
+                return Reference(&ValueColumn[Rank], nullptr);
+            }
+            return Reference(nullptr, &ErrorColumn[Index - Rank]);
+        }
+
+        [[nodiscard]] ConstReference operator[](std::size_t Index) const noexcept {
+            std::size_t Rank = CountValues(Index);
+            if (HasValue(Index)) {
+                return ConstReference(&ValueColumn[Rank], nullptr);
+            }
+            return ConstReference(nullptr, &ErrorColumn[Index - Rank]);
+        }
+
+        [[nodiscard]] details::BatchColumn<T> Values() noexcept {
+            return details::BatchColumn<T>(ValueColumn.data(), ValueColumn.size());
+        }
+
+        [[nodiscard]] details::BatchColumn<const T> Values() const noexcept {
+            return details::BatchColumn<const T>(ValueColumn.data(), ValueColumn.size());
+        }
+
+        [[nodiscard]] details::BatchColumn<E> Errors() noexcept {
+            return details::BatchColumn<E>(ErrorColumn.data(), ErrorColumn.size());
+        }
+
+        [[nodiscard]] details::BatchColumn<const E> Errors() const noexcept {
+            return details::BatchColumn<const E>(ErrorColumn.data(), ErrorColumn.size());
+        }
+
+        // Word Index of the validity bitmap: bit I tells whether element 64 * Index + I holds a value.
+        [[nodiscard]] std::uint64_t BitmapWord(std::size_t Index) const noexcept {
+            return Words[Index].Bits;
+        }
+
+    private:
+        // The bits of 64 consecutive elements, next to the number of values stored before the first of them.
+        struct Word {
+            std::uint64_t Bits;
+            std::size_t Rank;
+        };
+
+        // Adds the word of the next element if needed. Runs before the element is constructed, so an exception thrown
+        // by its constructor leaves at most an empty trailing word behind, which the next append reuses.
+        void Grow() {
+            if (Words.size() * WordBits == Count) {
+                Words.push_back(Word{0, ValueColumn.size()});
+            }
+        }
+
+        std::vector<T> ValueColumn;
+        std::vector<E> ErrorColumn;
+        std::vector<Word> Words;
+        std::size_t Count = 0;
+    };
+}
@@ -0,0 +1,420 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::details {
+    // Blocking is rare next to the hand-off itself, so waiters are parked on one of a few condition variables picked by
+    // the address of the slot they wait on, rather than each slot carrying a mutex and a condition variable of its own.
+    struct alignas(64) ParkingStripe {
+        std::mutex Mutex;
+        std::condition_variable Wakeup;
+    };
+
+    constexpr std::size_t ParkingStripeCount = 64;
+
+    inline ParkingStripe ParkingStripes[ParkingStripeCount];
+
+    [[nodiscard]] inline ParkingStripe& ParkingStripeOf(const void* Address) noexcept {
+        return ParkingStripes[MixHash(std::size_t(reinterpret_cast<std::uintptr_t>(Address))) % ParkingStripeCount];
+    }
+
+    // Wakes the waiters parked on Address. Taking the mutex orders the wakeup after a waiter that flagged itself has
+    // actually started waiting, so it cannot be lost. The slot itself is not touched: it may already be gone.
+    _EXPECTED_COLD inline void UnparkWaiters(const void* Address) {
+        ParkingStripe& Stripe = ParkingStripeOf(Address);
+        {
+            std::lock_guard<std::mutex> Lock(Stripe.Mutex);
+        }
+        Stripe.Wakeup.notify_all();
+    }
+
+    [[noreturn]] _EXPECTED_COLD inline void ThrowFutureError(std::future_errc Code) {
+#if defined(STDX_EXPECTED_NO_EXCEPTIONS)
+        static_cast<void>(Code);
+        STDX_EXPECTED_BAD_ACCESS_HANDLER();
+        std::abort();
+#else
+        throw std::future_error(Code);
+#endif
+    }
+
+    /*
+     * The state shared by an ExpectedPromise and its ExpectedFuture: the result, in the same union Expected keeps it
+     * in, and one atomic word. Each side changes the word with a single fetch_or and whichever side flags itself second
+     * destroys the slot, so neither a reference count nor a lock is needed.
+     */
+    template <typename T, typename E>
+    class ExpectedSlot {
+    public:
+        using Deleter = void (*)(ExpectedSlot*) noexcept;
+
+        // The promise has set the result.
+        static constexpr std::uint32_t Ready = 1;
+        // The promise is gone without setting it.
+        static constexpr std::uint32_t Broken = 2;
+        // The future is parked until one of the two above.
+        static constexpr std::uint32_t Waiting = 4;
+        // The future is gone.
+        static constexpr std::uint32_t Abandoned = 8;
+
+        explicit ExpectedSlot(Deleter Delete) noexcept : Data(valueless), Delete(Delete) {}
+
+        ExpectedSlot(const ExpectedSlot&) = delete;
+
+        ExpectedSlot& operator=(const ExpectedSlot&) = delete;
+
+        ~ExpectedSlot() {
+            if ((State.load(std::memory_order_relaxed) & Ready) != 0) {
+                if (bHasValue) {
+                    if constexpr (!IsVoid<T>()) {
+                        Data.Value.~T();
+                    }
+                } else {
+                    Data.Unex.~Unexpected();
+                }
+            }
+        }
+
+        template <typename... Ts>
+        void ConstructValue(Ts&&... Args) noexcept(NothrowConstructible<T, Ts...>()) {
+            if constexpr (!IsVoid<T>()) {
+                ConstructAt(std::addressof(Data.Value), std::forward<Ts>(Args)...);
+            }
+            bHasValue = true;
+        }
+
+        template <typename... Ts>
+        void ConstructError(Ts&&... Args) noexcept(NothrowConstructible<E, Ts...>()) {
+            ConstructAt(std::addressof(Data.Unex), untracked, std::forward<Ts>(Args)...);
+            bHasValue = false;
+        }
+
+        // Called by the promise once the result is constructed, or with Broken when it never will be. Outcome also
+        // carries Abandoned when the future was never handed out.
+        void Publish(std::uint32_t Outcome) {
+            const std::uint32_t Previous = State.fetch_or(Outcome, std::memory_order_acq_rel);
+            if (((Previous | Outcome) & Abandoned) != 0) {
+                Delete(this);
+            } else if (_EXPECTED_UNLIKELY((Previous & Waiting) != 0)) {
+                UnparkWaiters(this);
+            }
+        }
+
+        void Abandon() noexcept {
+            if ((State.fetch_or(Abandoned, std::memory_order_acq_rel) & (Ready | Broken)) != 0) {
+                Delete(this);
+            }
+        }
+
+        [[nodiscard]] bool IsDone() const noexcept {
+            return (State.load(std::memory_order_acquire) & (Ready | Broken)) != 0;
+        }
+
+        void Wait() {
+            Park([](ParkingStripe& Stripe, std::unique_lock<std::mutex>& Lock) {
+                Stripe.Wakeup.wait(Lock);
+                return true;
+            });
+        }
+
+        template <typename Clock, typename Duration>
+        bool WaitUntil(const std::chrono::time_point<Clock, Duration>& Deadline) {
+            return Park([&Deadline](ParkingStripe& Stripe, std::unique_lock<std::mutex>& Lock) {
+                return Stripe.Wakeup.wait_until(Lock, Deadline) == std::cv_status::no_timeout;
+            });
+        }
+
+        // Moves the result out. Only valid once IsDone() holds.
+        [[nodiscard]] Expected<T, E> Take() {
+            if (_EXPECTED_UNLIKELY((State.load(std::memory_order_acquire) & Broken) != 0)) {
+                ThrowFutureError(std::future_errc::broken_promise);
+            }
+            if (bHasValue) {
+                if constexpr (IsVoid<T>()) {
+                    return Expected<T, E>();
+                } else {
+                    return Expected<T, E>(std::in_place, std::move(Data.Value));
+                }
+            }
+            return Expected<T, E>(untracked, std::move(Data.Unex).Value());
+        }
+
+    private:
+        // Spins briefly, as the result often arrives within a few hundred cycles, then flags the slot and blocks until
+        // the promise is done or Block reports a timeout.
+        template <typename F>
+        bool Park(F&& Block) {
+            for (int Spin = 0; Spin < 64; ++Spin) {
+                if (IsDone()) {
+                    return true;
+                }
+            }
+
+            ParkingStripe& Stripe = ParkingStripeOf(this);
+            std::unique_lock<std::mutex> Lock(Stripe.Mutex);
+            while ((State.fetch_or(Waiting, std::memory_order_acq_rel) & (Ready | Broken)) == 0) {
+                if (!Block(Stripe, Lock)) {
+                    return IsDone();
+                }
+            }
+            return true;
+        }
+
+        ExpectedUnion<T, E> Data;
+        bool bHasValue = false;
+        std::atomic<std::uint32_t> State{0};
+        Deleter Delete;
+    };
+
+    // A slot together with the allocator it came from, which gives it back to that allocator when released.
+    template <typename T, typename E, typename Allocator>
+    class AllocatedSlot final : public ExpectedSlot<T, E> {
+        using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<AllocatedSlot>;
+        using SlotTraits = std::allocator_traits<SlotAllocator>;
+
+    public:
+        explicit AllocatedSlot(const SlotAllocator& Alloc) noexcept :
+            ExpectedSlot<T, E>(&AllocatedSlot::Destroy), Alloc(Alloc) {}
+
+        [[nodiscard]] static ExpectedSlot<T, E>* Create(const Allocator& Source) {
+            SlotAllocator Alloc(Source);
+            AllocatedSlot* Slot = SlotTraits::allocate(Alloc, 1);
+            return ::new (static_cast<void*>(Slot)) AllocatedSlot(Alloc);
+        }
+
+    private:
+        static void Destroy(ExpectedSlot<T, E>* Base) noexcept {
+            AllocatedSlot* Slot = static_cast<AllocatedSlot*>(Base);
+            SlotAllocator Alloc(std::move(Slot->Alloc));
+            Slot->~AllocatedSlot();
+            SlotTraits::deallocate(Alloc, Slot, 1);
+        }
+
+        SlotAllocator Alloc;
+    };
+}
+
+namespace stdx {
+    template <typename T, typename E>
+    class ExpectedPromise;
+
+    /*
+     * The receiving end of a one-shot channel carrying an Expected<T, E> from one thread to another, a lighter
+     * std::future: the result lives in the slot it shares with its ExpectedPromise, and neither side takes a lock unless
+     * the future has to block. Polling with IsReady() never blocks at all.
+     */
+    template <typename T, typename E>
+    class ExpectedFuture {
+    public:
+        using ResultType = Expected<T, E>;
+
+        constexpr ExpectedFuture() noexcept = default;
+
+        ExpectedFuture(ExpectedFuture&& Other) noexcept : Slot(std::exchange(Other.Slot, nullptr)) {}
+
+        ExpectedFuture& operator=(ExpectedFuture&& Other) noexcept {
+            if (this != &Other) {
+                Release();
+                Slot = std::exchange(Other.Slot, nullptr);
+            }
+            return *this;
+        }
+
+        ~ExpectedFuture() {
+            Release();
+        }
+
+        // False once the result has been taken, and for default-constructed and moved-from futures.
+        [[nodiscard]] bool Valid() const noexcept {
+            return Slot != nullptr;
+        }
+
+        // True once the promise has set the result or has been destroyed without setting it.
+        [[nodiscard]] bool IsReady() const noexcept {
+            return Slot->IsDone();
+        }
+
+        void Wait() const {
+            Slot->Wait();
+        }
+
+        template <typename Rep, typename Period>
+        bool WaitFor(const std::chrono::duration<Rep, Period>& Timeout) const {
+            return WaitUntil(std::chrono::steady_clock::now() + Timeout);
+        }
+
+        template <typename Clock, typename Duration>
+        bool WaitUntil(const std::chrono::time_point<Clock, Duration>& Deadline) const {
+            return Slot->WaitUntil(Deadline);
+        }
+
+        // Waits for the result and moves it out, leaving the future invalid. Throws std::future_error if the promise
+        // was destroyed without setting it (or calls STDX_EXPECTED_BAD_ACCESS_HANDLER when exceptions are disabled).
+        [[nodiscard]] ResultType Get() {
+            Wait();
+            details::ExpectedSlot<T, E>* Taken = std::exchange(Slot, nullptr);
+            struct AbandonOnExit {
+                ~AbandonOnExit() {
+                    Taken->Abandon();
+                }
+
+                details::ExpectedSlot<T, E>* Taken;
+            } Guard{Taken};
+            return Taken->Take();
+        }
+
+    private:
+        friend class ExpectedPromise<T, E>;
+
+        explicit ExpectedFuture(details::ExpectedSlot<T, E>* Slot) noexcept : Slot(Slot) {}
+
+        void Release() noexcept {
+            if (Slot != nullptr) {
+                std::exchange(Slot, nullptr)->Abandon();
+            }
+        }
+
+        details::ExpectedSlot<T, E>* Slot = nullptr;
+    };
+
+    /*
+     * The sending end of the channel. The slot is allocated once, when the promise is created: with std::allocator by
+     * default, or from the allocator passed as std::allocator_arg, Alloc, e.g. a std::pmr::polymorphic_allocator over
+     * an arena, so that a hand-off costs no heap allocation at all.
+     *
+     * The result is set at most once, by SetValue, SetError or Set, which never block, before or after the future is
+     * handed out. Setting it again throws std::future_error with promise_already_satisfied, and setting it through a
+     * moved-from promise with no_state (or calls STDX_EXPECTED_BAD_ACCESS_HANDLER when exceptions are disabled). A
+     * promise destroyed without setting it breaks the future.
+     */
+    template <typename T, typename E>
+    class ExpectedPromise {
+        static_assert(!std::is_reference_v<T>, "ExpectedPromise of a reference is not supported");
+
+    public:
+        using ResultType = Expected<T, E>;
+
+        ExpectedPromise() : ExpectedPromise(std::allocator_arg, std::allocator<char>()) {}
+
+        template <typename Allocator>
+        ExpectedPromise(std::allocator_arg_t, const Allocator& Alloc) :
+            Slot(details::AllocatedSlot<T, E, Allocator>::Create(Alloc)) {}
+
+        ExpectedPromise(ExpectedPromise&& Other) noexcept :
+            Slot(std::exchange(Other.Slot, nullptr)),
+            bFutureRetrieved(std::exchange(Other.bFutureRetrieved, false)),
+            bResultSet(std::exchange(Other.bResultSet, false)) {}
+
+        ExpectedPromise& operator=(ExpectedPromise&& Other) noexcept {
+            if (this != &Other) {
+                Release();
+                Slot = std::exchange(Other.Slot, nullptr);
+                bFutureRetrieved = std::exchange(Other.bFutureRetrieved, false);
+                bResultSet = std::exchange(Other.bResultSet, false);
+            }
+            return *this;
+        }
+
+        ~ExpectedPromise() {
+            Release();
+        }
+
+        // False once the result has been set, and for moved-from promises.
+        [[nodiscard]] bool Valid() const noexcept {
+            return Slot != nullptr && !bResultSet;
+        }
+
+        // Hands out the future of this promise. A second call returns an invalid future.
+        [[nodiscard]] ExpectedFuture<T, E> GetFuture() noexcept {
+            if (Slot == nullptr || std::exchange(bFutureRetrieved, true)) {
+                return ExpectedFuture<T, E>();
+            }
+            if (bResultSet) {
+                // The result is already published, so the promise has nothing left to do with the slot.
+                return ExpectedFuture<T, E>(std::exchange(Slot, nullptr));
+            }
+            return ExpectedFuture<T, E>(Slot);
+        }
+
+        template <typename... Ts>
+        void SetValue(Ts&&... Args) {
+            CheckUnset();
+            Slot->ConstructValue(std::forward<Ts>(Args)...);
+            Publish();
+        }
+
+        template <typename... Ts>
+        void SetError(Ts&&... Args) {
+            CheckUnset();
+            Slot->ConstructError(std::forward<Ts>(Args)...);
+            Publish();
+        }
+
+        void Set(const ResultType& Result) {
+            SetFrom(Result);
+        }
+
+        void Set(ResultType&& Result) {
+            SetFrom(std::move(Result));
+        }
+
+    private:
+        template <typename U>
+        void SetFrom(U&& Result) {
+            CheckUnset();
+            if (Result.HasValue()) {
+                if constexpr (details::IsVoid<T>()) {
+                    Slot->ConstructValue();
+                } else {
+                    Slot->ConstructValue(*std::forward<U>(Result));
+                }
+            } else {
+                Slot->ConstructError(std::forward<U>(Result).Error());
+            }
+            Publish();
+        }
+
+        // Once set, the slot is either handed over to the future or kept with bResultSet, so a null slot without a
+        // future retrieved can only mean a moved-from promise.
+        void CheckUnset() const {
+            if (_EXPECTED_UNLIKELY(Slot == nullptr || bResultSet)) {
+                const bool bMovedFrom = Slot == nullptr && !bFutureRetrieved;
+                details::ThrowFutureError(bMovedFrom ? std::future_errc::no_state : std::future_errc::promise_already_satisfied);
+            }
+        }
+
+        // Without a future yet, the promise keeps the slot so that GetFuture can still hand the result out.
+        void Publish() {
+            Slot->Publish(details::ExpectedSlot<T, E>::Ready);
+            if (bFutureRetrieved) {
+                Slot = nullptr;
+            } else {
+                bResultSet = true;
+            }
+        }
+
+        void Release() noexcept {
+            if (Slot != nullptr && bResultSet) {
+                // Set but never handed out: nobody can read the result any more.
+                std::exchange(Slot, nullptr)->Abandon();
+            } else if (Slot != nullptr) {
+                const std::uint32_t Outcome = details::ExpectedSlot<T, E>::Broken |
+                    (bFutureRetrieved ? 0 : details::ExpectedSlot<T, E>::Abandoned);
+                std::exchange(Slot, nullptr)->Publish(Outcome);
+            }
+        }
+
+        details::ExpectedSlot<T, E>* Slot;
+        bool bFutureRetrieved = false;
+        bool bResultSet = false;
+    };
+}
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::details {
+    template <typename T>
+    struct WireTraits {
+        static constexpr std::size_t Size = sizeof(T);
+        static constexpr std::size_t Alignment = alignof(T);
+    };
+
+    template <>
+    struct WireTraits<void> {
+        static constexpr std::size_t Size = 0;
+        static constexpr std::size_t Alignment = 1;
+    };
+
+    constexpr std::size_t MaxOf(std::size_t A, std::size_t B) noexcept {
+        return A < B ? B : A;
+    }
+
+    constexpr std::size_t AlignUp(std::size_t Size, std::size_t Alignment) noexcept {
+        return (Size + Alignment - 1) / Alignment * Alignment;
+    }
+}
+
+namespace stdx {
+    enum class WireError : std::uint8_t {
+        // The buffer is shorter than WireFormat<T, E>::Size.
+        TooShort = 1,
+        // The buffer is not aligned to WireFormat<T, E>::Alignment, so the payload cannot be referenced in place.
+        Misaligned,
+        // The tag byte is neither ValueTag nor ErrorTag.
+        BadTag
+    };
+
+    /*
+     * The wire layout of an Expected<T, E> whose alternatives are trivially copyable:
+     *
+     *   [0]              tag: ValueTag or ErrorTag
+     *   [1, Offset)      zero
+     *   [Offset, +Max)   the bytes of the value or of the error, zero-filled up to the larger of the two
+     *   [.., Size)       zero
+     *
+     * Offset is the alignment of the alternatives and Size a multiple of it, so records can be laid out back to back and
+     * each one read in place. Unlike the in-memory layout, which depends on niches and on the width of the discriminant,
+     * it only depends on T and E themselves, whose bytes (padding included) are written as the host holds them: both
+     * ends have to agree on their representation, byte order included.
+     */
+    template <typename T, typename E>
+    struct WireFormat {
+        static_assert(!std::is_reference_v<T>, "a reference cannot be written to the wire");
+        static_assert(details::VoidOrTriviallyCopyable<T>(), "the value type of a wire Expected must be trivially copyable");
+        static_assert(details::TriviallyCopyable<E>(), "the error type of a wire Expected must be trivially copyable");
+
+        static constexpr std::uint8_t ValueTag = 1;
+        static constexpr std::uint8_t ErrorTag = 2;
+
+        static constexpr std::size_t Alignment =
+            details::MaxOf(details::WireTraits<T>::Alignment, details::WireTraits<E>::Alignment);
+        static constexpr std::size_t PayloadOffset = Alignment;
+        static constexpr std::size_t PayloadSize = details::MaxOf(details::WireTraits<T>::Size, sizeof(E));
+        static constexpr std::size_t Size = details::AlignUp(PayloadOffset + PayloadSize, Alignment);
+    };
+
+    // Writes Ex to Buffer, which needs no particular alignment. Returns the number of bytes written, WireFormat::Size.
+    template <typename T, typename E>
+    Expected<std::size_t, WireError> WriteWire(const Expected<T, E>& Ex, void* Buffer, std::size_t Capacity) noexcept {
+        using Format = WireFormat<T, E>;
+
+        if (_EXPECTED_UNLIKELY(Capacity < Format::Size)) {
+            return Unexpected(WireError::TooShort);
+        }
+
+        // The bytes around the payload are zeroed as they are written, rather than all beforehand, so that no store
+        // overlaps another.
+        unsigned char Header[Format::PayloadOffset] = {};
+        unsigned char* Bytes = static_cast<unsigned char*>(Buffer);
+        if (Ex.HasValue()) {
+            Header[0] = Format::ValueTag;
+            std::memcpy(Bytes, Header, Format::PayloadOffset);
+            if constexpr (!details::IsVoid<T>()) {
+                std::memcpy(Bytes + Format::PayloadOffset, std::addressof(*Ex), sizeof(T));
+            }
+            std::memset(Bytes + Format::PayloadOffset + details::WireTraits<T>::Size, 0,
+                        Format::Size - Format::PayloadOffset - details::WireTraits<T>::Size);
+        } else {
+            Header[0] = Format::ErrorTag;
+            std::memcpy(Bytes, Header, Format::PayloadOffset);
+            std::memcpy(Bytes + Format::PayloadOffset, std::addressof(Ex.Error()), sizeof(E));
+            std::memset(Bytes + Format::PayloadOffset + sizeof(E), 0, Format::Size - Format::PayloadOffset - sizeof(E));
+        }
+        return Format::Size;
+    }
+
+    /*
+     * An Expected<T, E> read in place from a buffer in the wire layout, e.g. a received message or a mapped file. Its
+     * observers mirror those of Expected, but refer to the bytes of the buffer, which has to outlive the view.
+     */
+    template <typename T, typename E>
+    class ExpectedView {
+        using Format = WireFormat<T, E>;
+
+    public:
+        using ValueType = T;
+        using ErrorType = E;
+
+        // Checks that Buffer holds a whole, aligned record with a valid tag.
+        [[nodiscard]] static Expected<ExpectedView, WireError> Read(const void* Buffer, std::size_t Size) noexcept {
+            if (_EXPECTED_UNLIKELY(Size < Format::Size)) {
+                return Unexpected(WireError::TooShort);
+            }
+            if (_EXPECTED_UNLIKELY(reinterpret_cast<std::uintptr_t>(Buffer) % Format::Alignment != 0)) {
+                return Unexpected(WireError::Misaligned);
+            }
+            const std::uint8_t Tag = *static_cast<const unsigned char*>(Buffer);
+            if (_EXPECTED_UNLIKELY(Tag != Format::ValueTag && Tag != Format::ErrorTag)) {
+                return Unexpected(WireError::BadTag);
+            }
+            return ExpectedView(static_cast<const unsigned char*>(Buffer));
+        }
+
+        [[nodiscard]] bool HasValue() const noexcept {
+            return *Bytes == Format::ValueTag;
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept {
+            return HasValue();
+        }
+
+        template <typename U = T, typename = std::enable_if_t<!details::IsVoid<U>()>>
+        [[nodiscard]] const U& operator*() const noexcept {
+            return *Payload<U>();
+        }
+
+        template <typename U = T, typename = std::enable_if_t<!details::IsVoid<U>()>>
+        [[nodiscard]] const U* operator->() const noexcept {
+            return Payload<U>();
+        }
+
+        template <typename U = T, typename = std::enable_if_t<!details::IsVoid<U>()>>
+        [[nodiscard]] const U& Value() const {
+            if (_EXPECTED_UNLIKELY(!HasValue())) {
+                details::ThrowBadExpectedAccess(Error());
+            }
+            return *Payload<U>();
+        }
+
+        template <typename U, typename X = T, typename = std::enable_if_t<!details::IsVoid<X>()>>
+        [[nodiscard]] X ValueOr(U&& Default) const {
+            return HasValue() ? *Payload<X>() : static_cast<X>(std::forward<U>(Default));
+        }
+
+        [[nodiscard]] const E& Error() const noexcept {
+            return *Payload<E>();
+        }
+
+        // Copies the record out into an Expected.
+        [[nodiscard]] Expected<T, E> Load() const noexcept {
+            if (HasValue()) {
+                if constexpr (details::IsVoid<T>()) {
+                    return Expected<T, E>();
+                } else {
+                    return Expected<T, E>(std::in_place, *Payload<T>());
+                }
+            }
+            return Expected<T, E>(details::untracked, Error());
+        }
+
+    private:
+        explicit ExpectedView(const unsigned char* Bytes) noexcept : Bytes(Bytes) {}
+
+        // The payload is an object of a trivially copyable type placed in the buffer by whoever filled it, the way
+        // received messages are read without copying.
+        template <typename X>
+        [[nodiscard]] const X* Payload() const noexcept {
+            return std::launder(reinterpret_cast<const X*>(Bytes + Format::PayloadOffset));
+        }
+
+        const unsigned char* Bytes;
+    };
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::details {
+    // One shard of a MemoCache: a hash index over two recency lists, one of values and one of errors, with the most
+    // recently used entry of each kind at the front. Every member function expects the mutex to be held.
+    template <typename Key, typename T, typename E, typename Hash, typename KeyEqual>
+    struct alignas(64) MemoShard {
+        using ResultType = Expected<T, E>;
+
+        struct Entry {
+            Key EntryKey;
+            ResultType Result;
+        };
+
+        using EntryList = std::list<Entry>;
+
+        [[nodiscard]] const ResultType* Find(const Key& K) {
+            const auto It = Index.find(K);
+            if (It == Index.end()) {
+                return nullptr;
+            }
+            EntryList& List = ListOf(It->second->Result);
+            List.splice(List.begin(), List, It->second);
+            return &It->second->Result;
+        }
+
+        void Insert(const Key& K, const ResultType& Result, std::size_t ValueCapacity, std::size_t ErrorCapacity) {
+            const std::size_t Capacity = Result.HasValue() ? ValueCapacity : ErrorCapacity;
+            Erase(K);
+            if (Capacity == 0) {
+                return;
+            }
+
+            EntryList& List = ListOf(Result);
+            if (List.size() == Capacity) {
+                Index.erase(List.back().EntryKey);
+                List.pop_back();
+            }
+            List.push_front(Entry{K, Result});
+            Index.emplace(K, List.begin());
+        }
+
+        bool Erase(const Key& K) {
+            const auto It = Index.find(K);
+            if (It == Index.end()) {
+                return false;
+            }
+            ListOf(It->second->Result).erase(It->second);
+            Index.erase(It);
+            return true;
+        }
+
+        void Clear() noexcept {
+            Index.clear();
+            Values.clear();
+            Errors.clear();
+        }
+
+        [[nodiscard]] EntryList& ListOf(const ResultType& Result) noexcept {
+            return Result.HasValue() ? Values : Errors;
+        }
+
+        std::mutex Mutex;
+        EntryList Values;
+        EntryList Errors;
+        std::unordered_map<Key, typename EntryList::iterator, Hash, KeyEqual> Index;
+    };
+}
+
+namespace stdx {
+    /*
+     * A thread-safe memo of a function returning Expected<T, E>, for resolvers that are called over and over with the
+     * same keys. Keys are spread by hash over shards that each have their own mutex, so lookups of different keys
+     * rarely contend.
+     *
+     * Errors are cached as well as values, but apart from them: a shard holds at most its share of ValueCapacity values
+     * and of ErrorCapacity errors, and evicts the least recently used entry of the same kind when full. A storm of
+     * failing keys thus only cycles through the error entries and never pushes a value out. An ErrorCapacity of zero
+     * turns negative caching off. Keys never spread over the shards perfectly evenly, so a capacity meant to hold a
+     * whole working set needs some headroom above its size.
+     */
+    template <typename Key, typename T, typename E, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class MemoCache {
+        using Shard = details::MemoShard<Key, T, E, Hash, KeyEqual>;
+
+    public:
+        using KeyType = Key;
+        using ResultType = Expected<T, E>;
+
+        MemoCache(std::size_t ValueCapacity, std::size_t ErrorCapacity, std::size_t ShardCount = 16) :
+            Shards(std::make_unique<Shard[]>(ShardCount == 0 ? 1 : ShardCount)),
+            ShardCount(ShardCount == 0 ? 1 : ShardCount),
+            ValueCapacity(PerShard(ValueCapacity)),
+            ErrorCapacity(PerShard(ErrorCapacity)) {}
+
+        MemoCache(const MemoCache&) = delete;
+        MemoCache& operator=(const MemoCache&) = delete;
+
+        // Returns the cached result for K, or calls Compute(K) and caches what it returns. Compute runs without the
+        // lock held, so a slow resolver does not stall the other keys of its shard; concurrent misses on the same key
+        // may call it more than once, and the last result wins. Nothing is cached if Compute throws.
+        template <typename F>
+        ResultType GetOrCompute(const Key& K, F&& Compute) {
+            static_assert(
+                details::Convertible<std::invoke_result_t<F, const Key&>, ResultType>(),
+                "GetOrCompute requires a callable returning Expected<T, E>");
+
+            Shard& S = ShardOf(K);
+            {
+                std::lock_guard<std::mutex> Lock(S.Mutex);
+                if (const ResultType* Cached = S.Find(K)) {
+                    return *Cached;
+                }
+            }
+
+            ResultType Result = std::invoke(std::forward<F>(Compute), K);
+            std::lock_guard<std::mutex> Lock(S.Mutex);
+            S.Insert(K, Result, ValueCapacity, ErrorCapacity);
+            return Result;
+        }
+
+        [[nodiscard]] std::optional<ResultType> Find(const Key& K) {
+            Shard& S = ShardOf(K);
+            std::lock_guard<std::mutex> Lock(S.Mutex);
+            if (const ResultType* Cached = S.Find(K)) {
+                return *Cached;
+            }
+            return std::nullopt;
+        }
+
+        void Insert(const Key& K, const ResultType& Result) {
+            Shard& S = ShardOf(K);
+            std::lock_guard<std::mutex> Lock(S.Mutex);
+            S.Insert(K, Result, ValueCapacity, ErrorCapacity);
+        }
+
+        bool Erase(const Key& K) {
+            Shard& S = ShardOf(K);
+            std::lock_guard<std::mutex> Lock(S.Mutex);
+            return S.Erase(K);
+        }
+
+        void Clear() {
+            for (std::size_t I = 0; I < ShardCount; ++I) {
+                std::lock_guard<std::mutex> Lock(Shards[I].Mutex);
+                Shards[I].Clear();
+            }
+        }
+
+        [[nodiscard]] std::size_t CountValues() const {
+            std::size_t Count = 0;
+            for (std::size_t I = 0; I < ShardCount; ++I) {
+                std::lock_guard<std::mutex> Lock(Shards[I].Mutex);
+                Count += Shards[I].Values.size();
+            }
+            return Count;
+        }
+
+        [[nodiscard]] std::size_t CountErrors() const {
+            std::size_t Count = 0;
+            for (std::size_t I = 0; I < ShardCount; ++I) {
+                std::lock_guard<std::mutex> Lock(Shards[I].Mutex);
+                Count += Shards[I].Errors.size();
+            }
+            return Count;
+        }
+
+    private:
+        [[nodiscard]] std::size_t PerShard(std::size_t Capacity) const noexcept {
+            return (Capacity + ShardCount - 1) / ShardCount;
+        }
+
+        // Hashes of pointers and other aligned keys have constant low bits, which would send them all to a few shards.
+        [[nodiscard]] Shard& ShardOf(const Key& K) const {
+            return Shards[details::MixHash(Hasher(K)) % ShardCount];
+        }
+
+        std::unique_ptr<Shard[]> Shards;
+        std::size_t ShardCount;
+        std::size_t ValueCapacity;
+        std::size_t ErrorCapacity;
+        Hash Hasher;
+    };
+}
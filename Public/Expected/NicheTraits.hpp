@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+
+namespace stdx {
+    /*
+     * Opt-in description of a niche: a byte at offset Offset that never holds Value in a valid object of X.
+     * When T or E declares a niche that does not overlap the other alternative, Expected<T, E> stores its
+     * discriminant in that byte instead of a separate flag. For example:
+     *
+     * template <>
+     * struct stdx::NicheTraits<ErrCode> {
+     *     static constexpr std::size_t Offset = 0;
+     *     static constexpr unsigned char Value = 0xFF;
+     * };
+     */
+    template <typename X>
+    struct NicheTraits {};
+}
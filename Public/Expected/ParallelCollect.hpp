@@ -0,0 +1,341 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <Expected/Collect.hpp>
+#include <Expected/Expected.hpp>
+
+namespace stdx {
+    /*
+     * A fixed set of threads for fork-join work such as ParallelCollect. Run(Job) calls Job(Worker) once on each of
+     * the Size() threads, the calling one included as worker 0, and returns once every call has returned; the other
+     * threads sleep between runs. Runs started from several threads at a time are serialized. A job must not throw on
+     * the pool's own threads, nor start a run on the pool it runs on.
+     */
+    class ThreadPool {
+    public:
+        explicit ThreadPool(std::size_t ThreadCount = DefaultThreadCount()) {
+            const std::size_t Helpers = ThreadCount > 1 ? ThreadCount - 1 : 0;
+            Threads.reserve(Helpers);
+            for (std::size_t Worker = 1; Worker <= Helpers; ++Worker) {
+                Threads.emplace_back([this, Worker] { Work(Worker); });
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> Lock(Mutex);
+                bStopping = true;
+            }
+            Wakeup.notify_all();
+            for (std::thread& Thread : Threads) {
+                Thread.join();
+            }
+        }
+
+        [[nodiscard]] static std::size_t DefaultThreadCount() noexcept {
+            const unsigned Count = std::thread::hardware_concurrency();
+            return Count == 0 ? 1 : std::size_t(Count);
+        }
+
+        [[nodiscard]] std::size_t Size() const noexcept {
+            return Threads.size() + 1;
+        }
+
+        template <typename F>
+        void Run(F&& Job) {
+            std::lock_guard<std::mutex> RunLock(RunMutex);
+            {
+                std::lock_guard<std::mutex> Lock(Mutex);
+                Context = const_cast<void*>(static_cast<const void*>(std::addressof(Job)));
+                Invoke = [](void* Target, std::size_t Worker) {
+                    (*static_cast<std::remove_reference_t<F>*>(Target))(Worker);
+                };
+                Pending = Threads.size();
+                ++Generation;
+            }
+            Wakeup.notify_all();
+
+            // The other threads refer to Job until they are done with it, even if the call below throws.
+            struct JoinOnExit {
+                ~JoinOnExit() {
+                    std::unique_lock<std::mutex> Lock(Pool.Mutex);
+                    Pool.Finished.wait(Lock, [this] { return Pool.Pending == 0; });
+                }
+
+                ThreadPool& Pool;
+            } Guard{*this};
+            Job(std::size_t(0));
+        }
+
+    private:
+        void Work(std::size_t Worker) {
+            std::uint64_t Seen = 0;
+            std::unique_lock<std::mutex> Lock(Mutex);
+            for (;;) {
+                Wakeup.wait(Lock, [this, &Seen] { return bStopping || Generation != Seen; });
+                if (bStopping) {
+                    return;
+                }
+                Seen = Generation;
+                void* const Job = Context;
+                void (*const Call)(void*, std::size_t) = Invoke;
+
+                Lock.unlock();
+                Call(Job, Worker);
+                Lock.lock();
+                if (--Pending == 0) {
+                    Finished.notify_one();
+                }
+            }
+        }
+
+        std::mutex RunMutex;
+        std::mutex Mutex;
+        std::condition_variable Wakeup;
+        std::condition_variable Finished;
+        void* Context = nullptr;
+        void (*Invoke)(void*, std::size_t) = nullptr;
+        std::uint64_t Generation = 0;
+        std::size_t Pending = 0;
+        bool bStopping = false;
+        std::vector<std::thread> Threads;
+    };
+}
+
+namespace stdx::details {
+    /*
+     * Where the values of a parallel collection go, each to the index of the task that made it, so that tasks finishing
+     * out of order need no further shuffling. Values that can be default constructed are move-assigned into a vector
+     * allocated up front, which is then handed out as is; other values are constructed in raw slots and moved into the
+     * vector once every task has succeeded. So are bools: std::vector<bool> packs them into shared words, which several
+     * threads cannot write at once.
+     */
+    template <typename T, bool = DefaultConstructible<T>::value && !Same<T, bool>::value>
+    class CollectOutput {
+    public:
+        explicit CollectOutput(std::size_t Count) : Values(Count) {}
+
+        template <typename U>
+        void Store(std::size_t Index, U&& Value) {
+            Values[Index] = std::forward<U>(Value);
+        }
+
+        [[nodiscard]] std::vector<T> Take() && noexcept {
+            return std::move(Values);
+        }
+
+    private:
+        std::vector<T> Values;
+    };
+
+    template <typename T>
+    class CollectOutput<T, false> {
+    public:
+        // A byte per slot, for the same reason.
+        explicit CollectOutput(std::size_t Count) :
+            Slots(std::make_unique<Slot[]>(Count)), Constructed(std::make_unique<bool[]>(Count)), Count(Count) {}
+
+        CollectOutput(const CollectOutput&) = delete;
+
+        CollectOutput& operator=(const CollectOutput&) = delete;
+
+        ~CollectOutput() {
+            for (std::size_t Index = 0; Index < Count; ++Index) {
+                if (Constructed[Index]) {
+                    Slots[Index].Value.~T();
+                }
+            }
+        }
+
+        template <typename U>
+        void Store(std::size_t Index, U&& Value) {
+            ConstructAt(std::addressof(Slots[Index].Value), std::forward<U>(Value));
+            Constructed[Index] = true;
+        }
+
+        // Only valid once every slot holds a value.
+        [[nodiscard]] std::vector<T> Take() && {
+            std::vector<T> Values;
+            Values.reserve(Count);
+            for (std::size_t Index = 0; Index < Count; ++Index) {
+                Values.push_back(std::move(Slots[Index].Value));
+            }
+            return Values;
+        }
+
+    private:
+        union Slot {
+            Slot() noexcept {}
+
+            ~Slot() {}
+
+            T Value;
+        };
+
+        std::unique_ptr<Slot[]> Slots;
+        std::unique_ptr<bool[]> Constructed;
+        std::size_t Count;
+    };
+
+    template <>
+    class CollectOutput<void, false> {
+    public:
+        explicit CollectOutput(std::size_t) noexcept {}
+    };
+
+    /*
+     * The state the workers of a ParallelCollect share. Tasks are handed out in index order, a chunk at a time, from one
+     * atomic counter. FailedAt is the lowest index known to have failed: no task past it is started any more, while
+     * those before it all still run, so that the error reported is always the one of the lowest failing index, the same
+     * error Collect gives over the results in order, however the tasks were scheduled.
+     */
+    template <typename T, typename E>
+    class ParallelCollector {
+    public:
+        using ResultType = CollectResult<T, E>;
+
+        explicit ParallelCollector(std::size_t Count) : Output(Count), Count(Count), FailedAt(Count) {}
+
+        template <typename F>
+        void Work(F& Task, std::size_t Chunk) noexcept {
+            for (;;) {
+                const std::size_t First = Next.fetch_add(Chunk, std::memory_order_relaxed);
+                if (First >= FailedAt.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                const std::size_t Last = std::min(First + Chunk, Count);
+                for (std::size_t Index = First; Index < Last && Index < FailedAt.load(std::memory_order_relaxed); ++Index) {
+                    RunTask(Task, Index);
+                }
+            }
+        }
+
+        // Only valid once every worker has returned from Work.
+        ResultType Finish() && {
+            if (FailedAt.load(std::memory_order_relaxed) == Count) {
+                if constexpr (IsVoid<T>()) {
+                    return ResultType();
+                } else {
+                    return ResultType(std::in_place, std::move(Output).Take());
+                }
+            }
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
+            if (Exception) {
+                std::rethrow_exception(Exception);
+            }
+#endif
+            return ResultType(untracked, std::move(*Error));
+        }
+
+    private:
+        template <typename F>
+        void RunTask(F& Task, std::size_t Index) noexcept {
+            _EXPECTED_TRY {
+                auto&& Result = std::invoke(Task, Index);
+                if (_EXPECTED_LIKELY(Result.HasValue())) {
+                    if constexpr (!IsVoid<T>()) {
+                        Output.Store(Index, *std::move(Result));
+                    }
+                } else {
+                    Fail(Index, std::move(Result).Error());
+                }
+            }
+            _EXPECTED_CATCH_ALL {
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
+                FailWithException(Index, std::current_exception());
+#endif
+            }
+        }
+
+        template <typename G>
+        _EXPECTED_COLD void Fail(std::size_t Index, G&& Failure) {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            if (Index < FailedAt.load(std::memory_order_relaxed)) {
+                Error.emplace(std::forward<G>(Failure));
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
+                Exception = nullptr;
+#endif
+                FailedAt.store(Index, std::memory_order_relaxed);
+            }
+        }
+
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
+        _EXPECTED_COLD void FailWithException(std::size_t Index, std::exception_ptr Thrown) noexcept {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            if (Index < FailedAt.load(std::memory_order_relaxed)) {
+                Exception = std::move(Thrown);
+                FailedAt.store(Index, std::memory_order_relaxed);
+            }
+        }
+
+        std::exception_ptr Exception;
+#endif
+
+        CollectOutput<std::remove_cv_t<T>> Output;
+        std::size_t Count;
+        std::mutex Mutex;
+        std::optional<E> Error;
+        alignas(64) std::atomic<std::size_t> Next{0};
+        alignas(64) std::atomic<std::size_t> FailedAt;
+    };
+}
+
+namespace stdx {
+    /*
+     * Calls Task(0) to Task(Count - 1) on the threads of Pool, concurrently, and collects the Expected<T, E> they return
+     * as Collect does: into an Expected<std::vector<T>, E> holding the value of task I at index I, or the error of the
+     * lowest failing index. Once a task fails, no task past it is started any more. An exception thrown by a task counts
+     * as the failure of its index, and is rethrown here if that index turns out to be the lowest one.
+     *
+     * Each value is moved once from the result of its task into a vector allocated up front, unless T cannot be default
+     * constructed, in which case it is moved once more at the end. Chunk is the number of consecutive tasks a thread
+     * takes at a time; by default a thread takes about a sixteenth of its share.
+     */
+    template <typename F>
+    auto ParallelCollect(ThreadPool& Pool, std::size_t Count, F&& Task, std::size_t Chunk = 0) {
+        using X = details::RemoveCVRef<std::invoke_result_t<F&, std::size_t>>;
+        static_assert(details::IsExpectedSpecialization<X>(), "ParallelCollect requires a callable returning Expected");
+        static_assert(!std::is_reference_v<typename X::ValueType>, "ParallelCollect of Expected<T&, E> is not supported");
+
+        details::ParallelCollector<typename X::ValueType, typename X::ErrorType> Collector(Count);
+        if (Count != 0) {
+            if (Chunk == 0) {
+                Chunk = std::max<std::size_t>(1, Count / (Pool.Size() * 16));
+            }
+            Pool.Run([&Collector, &Task, Chunk](std::size_t) {
+                Collector.Work(Task, Chunk);
+            });
+        }
+        return std::move(Collector).Finish();
+    }
+
+    // The same over a random access range of callables taking no arguments, such as a std::vector<std::function<...>>.
+    template <typename Range>
+    auto ParallelCollect(ThreadPool& Pool, Range&& Tasks, std::size_t Chunk = 0) {
+        const auto First = std::begin(Tasks);
+        return ParallelCollect(
+            Pool,
+            std::size_t(std::distance(First, std::end(Tasks))),
+            [&First](std::size_t Index) {
+                return std::invoke(First[std::ptrdiff_t(Index)]);
+            },
+            Chunk);
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace stdx {
+    /*
+     * Opt-in: true for types whose objects can be moved to another address by copying their bytes, the original then
+     * being dropped without running its destructor. Trivially copyable types qualify on their own, and so does a type
+     * holding only pointers to memory it owns elsewhere, as long as none of them points into the object itself. Expected
+     * swaps and relocates such alternatives as plain bytes. For example:
+     *
+     * template <>
+     * struct stdx::IsTriviallyRelocatable<Handle> : std::true_type {};
+     *
+     * std::string does not qualify: libstdc++ points a short string at the buffer inside the object.
+     */
+    template <typename X>
+    struct IsTriviallyRelocatable : std::is_trivially_copyable<X> {};
+
+    template <typename X>
+    struct IsTriviallyRelocatable<std::unique_ptr<X>> : std::true_type {};
+
+    /*
+     * Moves the objects of [First, Last) into the uninitialized storage at Dest and ends the lifetime of the originals,
+     * as a container does when it grows. Returns the end of the relocated range. Trivially relocatable objects are copied
+     * in one memcpy, others are moved and destroyed one by one.
+     */
+    template <typename X>
+    X* UninitializedRelocate(X* First, X* Last, X* Dest) noexcept {
+        static_assert(
+            IsTriviallyRelocatable<X>::value || std::is_nothrow_move_constructible_v<X>,
+            "a relocation that may throw midway cannot be undone");
+
+        if constexpr (IsTriviallyRelocatable<X>::value) {
+            if (First != Last) {
+                std::memcpy(static_cast<void*>(Dest), static_cast<const void*>(First), std::size_t(Last - First) * sizeof(X));
+            }
+            return Dest + (Last - First);
+        } else {
+            for (; First != Last; ++First, ++Dest) {
+                ::new (static_cast<void*>(Dest)) X(std::move(*First));
+                First->~X();
+            }
+            return Dest;
+        }
+    }
+}
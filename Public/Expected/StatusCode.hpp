@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include <Expected/NicheTraits.hpp>
+
+namespace stdx {
+    /*
+     * A family of status codes. Domains are compared by identity, so each one must be a single object with static
+     * storage duration; the message for a code is only formatted when somebody asks for it.
+     */
+    class ErrorDomain {
+    public:
+        [[nodiscard]] virtual std::string_view Name() const noexcept = 0;
+
+        [[nodiscard]] virtual std::string Message(std::int64_t Code) const = 0;
+
+    protected:
+        constexpr ErrorDomain() noexcept = default;
+
+        ErrorDomain(const ErrorDomain&) = delete;
+
+        ErrorDomain& operator=(const ErrorDomain&) = delete;
+
+        ~ErrorDomain() = default;
+    };
+
+    namespace details {
+        class GenericErrorDomain final : public ErrorDomain {
+        public:
+            constexpr GenericErrorDomain() noexcept = default;
+
+            [[nodiscard]] std::string_view Name() const noexcept override {
+                return "generic";
+            }
+
+            [[nodiscard]] std::string Message(std::int64_t Code) const override {
+                return std::generic_category().message(int(Code));
+            }
+        };
+    }
+
+    // The domain of std::errc values.
+    [[nodiscard]] inline const ErrorDomain& GenericDomain() noexcept {
+        static constexpr details::GenericErrorDomain Domain;
+        return Domain;
+    }
+
+    /*
+     * A trivially copyable error made of a 64-bit code and the domain that gives it meaning. Creating, copying and
+     * propagating it never allocates, which makes the error path of Expected<T, StatusCode> as cheap as the value path.
+     */
+    class StatusCode {
+    public:
+        constexpr StatusCode(std::int64_t Code, const ErrorDomain& Domain) noexcept : Code(Code), Domain(&Domain) {}
+
+        StatusCode(std::errc Code) noexcept : StatusCode(std::int64_t(Code), GenericDomain()) {}
+
+        [[nodiscard]] constexpr std::int64_t Value() const noexcept {
+            return Code;
+        }
+
+        [[nodiscard]] constexpr const ErrorDomain& Category() const noexcept {
+            return *Domain;
+        }
+
+        [[nodiscard]] std::string Message() const {
+            return Domain->Message(Code);
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(const StatusCode& X, const StatusCode& Y) noexcept {
+            return X.Code == Y.Code && X.Domain == Y.Domain;
+        }
+
+        [[nodiscard]] friend constexpr bool operator!=(const StatusCode& X, const StatusCode& Y) noexcept {
+            return !(X == Y);
+        }
+
+    private:
+        friend struct NicheTraits<StatusCode>;
+
+        std::int64_t Code;
+        const ErrorDomain* Domain;
+    };
+
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_WIN32)
+    // Domains are polymorphic, hence at least pointer-aligned, so the lowest bit of the domain pointer is always clear.
+    // Setting it marks the error as absent, which lets Expected<T, StatusCode> drop its discriminant for small T.
+    template <>
+    struct NicheTraits<StatusCode> {
+        static constexpr std::size_t Offset = offsetof(StatusCode, Domain);
+        static constexpr unsigned char Value = 0x01;
+    };
+#endif
+}
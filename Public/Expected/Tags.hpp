@@ -6,4 +6,20 @@ namespace stdx {
     };
 
     constexpr unexpect_t unexpect;
+}
+
+namespace stdx::details {
+    struct in_place_invoke_t {
+        constexpr explicit in_place_invoke_t() = default;
+    };
+
+    constexpr in_place_invoke_t in_place_invoke;
+
+    // Constructs the error of an Expected or Unexpected that only carries on an error created earlier: a copy, a
+    // conversion, a propagation. Such errors are not reported to the error hooks again, see ErrorHooks.hpp.
+    struct untracked_t {
+        constexpr explicit untracked_t() = default;
+    };
+
+    constexpr untracked_t untracked;
 }
\ No newline at end of file
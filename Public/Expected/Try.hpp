@@ -0,0 +1,96 @@
+#pragma once
+
+#include <utility>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::details {
+    /*
+     * The error of a failed Expected on its way out of a function, see STDX_EXPECTED_TRY. It converts to whichever
+     * Expected the function returns, constructing its error directly in the return slot from the one it refers to: a
+     * single move of E, where `return Unexpected(std::move(X).Error())` moves it into a temporary Unexpected first.
+     */
+    template <typename ErrorRef>
+    class PropagatedError {
+    public:
+        explicit constexpr PropagatedError(ErrorRef Error) noexcept : Error(static_cast<ErrorRef>(Error)) {}
+
+        PropagatedError(const PropagatedError&) = delete;
+
+        PropagatedError& operator=(const PropagatedError&) = delete;
+
+        template <typename U, typename G, typename std::enable_if_t<Constructible<G, ErrorRef>::value, int> = 0>
+        constexpr operator Expected<U, G>() && noexcept(NothrowConstructible<G, ErrorRef>()) {
+            return Expected<U, G>(untracked, static_cast<ErrorRef>(Error));
+        }
+
+    private:
+        ErrorRef Error;
+    };
+
+    template <typename X>
+    constexpr auto PropagateError(X&& Failed) noexcept {
+        return PropagatedError<decltype(std::forward<X>(Failed).Error())>(std::forward<X>(Failed).Error());
+    }
+
+    // The value of a successful Expected, or nothing for Expected<void, E>.
+    template <typename X>
+    constexpr decltype(auto) TakeValue(X&& Succeeded) noexcept {
+        if constexpr (!IsVoid<ValueTypeOf<X>>()) {
+            return *std::forward<X>(Succeeded);
+        }
+    }
+}
+
+#define _EXPECTED_CONCAT_IMPL(A, B) A##B
+#define _EXPECTED_CONCAT(A, B) _EXPECTED_CONCAT_IMPL(A, B)
+
+#if defined(__COUNTER__)
+#define _EXPECTED_UNIQUE_NAME(Name) _EXPECTED_CONCAT(Name, __COUNTER__)
+#else
+#define _EXPECTED_UNIQUE_NAME(Name) _EXPECTED_CONCAT(Name, __LINE__)
+#endif
+
+#define _EXPECTED_RETURN_IF_ERROR(Result)                                                                                        \
+    if (_EXPECTED_UNLIKELY(!Result.HasValue())) {                                                                                \
+        return ::stdx::details::PropagateError(std::forward<decltype(Result)>(Result));                                         \
+    }
+
+/*
+ * Error propagation for functions returning Expected, without coroutines: each evaluates an Expected and, if it holds
+ * an error, returns that error from the enclosing function, whose return type may be any Expected with an error type
+ * constructible from it. The error is moved straight into the return slot when the Expected is an rvalue, and copied
+ * otherwise. It is carried on, not created, so error hooks do not count it again.
+ *
+ *   STDX_EXPECTED_TRY(Validate(Request));                         // any Expected, void included; the value is dropped
+ *   STDX_EXPECTED_TRY_ASSIGN(const Config Parsed, Parse(Text));   // declares or assigns the left-hand side
+ */
+#define STDX_EXPECTED_TRY(...)                                                                                                   \
+    do {                                                                                                                         \
+        auto&& _ExpectedResult = (__VA_ARGS__);                                                                                  \
+        _EXPECTED_RETURN_IF_ERROR(_ExpectedResult)                                                                               \
+    } while (false)
+
+#define STDX_EXPECTED_TRY_ASSIGN(Lhs, ...) _EXPECTED_TRY_ASSIGN_IMPL(_EXPECTED_UNIQUE_NAME(_ExpectedResult), Lhs, __VA_ARGS__)
+
+#define _EXPECTED_TRY_ASSIGN_IMPL(Result, Lhs, ...)                                                                              \
+    auto&& Result = (__VA_ARGS__);                                                                                               \
+    _EXPECTED_RETURN_IF_ERROR(Result)                                                                                            \
+    Lhs = *std::forward<decltype(Result)>(Result)
+
+/*
+ * Where statement expressions are available (GCC, Clang), STDX_EXPECTED_TRY_VALUE(Expr) is an expression: the value of
+ * Expr, returned by value, or nothing for Expected<void, E>. It returns the error from the enclosing function as above.
+ *
+ *   return Scale(STDX_EXPECTED_TRY_VALUE(Parse(Text)), Factor);
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define STDX_EXPECTED_HAS_TRY_VALUE
+
+#define STDX_EXPECTED_TRY_VALUE(...)                                                                                             \
+    __extension__({                                                                                                              \
+        auto&& _ExpectedResult = (__VA_ARGS__);                                                                                  \
+        _EXPECTED_RETURN_IF_ERROR(_ExpectedResult)                                                                               \
+        ::stdx::details::TakeValue(std::forward<decltype(_ExpectedResult)>(_ExpectedResult));                                    \
+    })
+#endif
@@ -1,5 +1,10 @@
 #pragma once
 
+#include <functional>
+
+#include <Expected/ErrorHooks.hpp>
+
+#include "Details/Hash.hpp"
 #include "Details/UnexpectedTraits.hpp"
 
 namespace stdx {
@@ -9,19 +14,31 @@ namespace stdx {
 
     public:
         template <typename G = E, typename std::enable_if_t<details::ConstructibleFromG<E, G>::value, int> = 0>
-        constexpr explicit Unexpected(G && Data) noexcept(details::NothrowConstructible<E, G>()) : Data(std::forward<G>(Data)) {}
+        constexpr explicit Unexpected(G && Data _EXPECTED_ERROR_SITE_PARAMETER) noexcept(details::NothrowConstructible<E, G>()) :
+            Data(std::forward<G>(Data)) {
+            _EXPECTED_RECORD_ERROR(E, Site);
+        }
 
         template <typename... Ts, typename std::enable_if_t<details::Constructible<E, Ts...>::value, int> = 0>
-        constexpr explicit Unexpected(std::in_place_t, Ts && ... Args) noexcept(details::NothrowConstructible<E, Ts...>()) :
-            Data(std::forward<Ts>(Args)...) {}
+        constexpr explicit Unexpected(details::InPlaceTag Tag, Ts && ... Args) noexcept(
+            details::NothrowConstructible<E, Ts...>()) :
+            Data(std::forward<Ts>(Args)...) {
+            _EXPECTED_RECORD_ERROR_AT(E, Tag);
+        }
 
         template <
             typename U,
             typename... Ts,
             typename std::enable_if_t<details::Constructible<E, std::initializer_list<U>&, Ts...>::value, int> = 0>
-        constexpr explicit Unexpected(std::in_place_t, std::initializer_list<U> List, Ts && ... Args) noexcept(
+        constexpr explicit Unexpected(details::InPlaceTag Tag, std::initializer_list<U> List, Ts && ... Args) noexcept(
             details::NothrowConstructible<E, std::initializer_list<U>&, Ts...>()) :
-            Data(List, std::forward<Ts>(Args)...) {}
+            Data(List, std::forward<Ts>(Args)...) {
+            _EXPECTED_RECORD_ERROR_AT(E, Tag);
+        }
+
+        template <typename... Ts, typename std::enable_if_t<details::Constructible<E, Ts...>::value, int> = 0>
+        constexpr explicit Unexpected(details::untracked_t, Ts && ... Args) noexcept(details::NothrowConstructible<E, Ts...>()) :
+            Data(std::forward<Ts>(Args)...) {}
 
         template <
             typename Err,
@@ -63,12 +80,23 @@ namespace stdx {
             return std::move(Data);
         }
 
-        void Swap(Unexpected & Other) noexcept(details::NothrowSwappable<E>()) {
+        _EXPECTED_CONSTEXPR20 void Swap(Unexpected & Other) noexcept(details::NothrowSwappable<E>()) {
             using std::swap;
             swap(Data, Other.Data);
         }
 
     private:
+        template <typename, typename, bool>
+        friend union details::ExpectedUnion;
+
+        template <typename, typename>
+        friend class details::ExpectedStorage;
+
+        template <typename F, typename... Ts>
+        constexpr explicit Unexpected(details::in_place_invoke_t, F && Func, Ts && ... Args) noexcept(
+            details::NothrowInvocable<F, Ts...>()) :
+            Data(std::invoke(std::forward<F>(Func), std::forward<Ts>(Args)...)) {}
+
         E Data;
     };
 
@@ -87,8 +115,44 @@ namespace stdx {
         return X.Value() != Y.Value();
     }
 
+    template <typename E1, typename E2>
+    [[nodiscard]] constexpr bool
+    operator<(const Unexpected<E1>& X, const Unexpected<E2>& Y) noexcept(noexcept(X.Value() < Y.Value())) {
+        return X.Value() < Y.Value();
+    }
+
+    template <typename E1, typename E2>
+    [[nodiscard]] constexpr bool operator>(const Unexpected<E1>& X, const Unexpected<E2>& Y) noexcept(noexcept(Y < X)) {
+        return Y < X;
+    }
+
+    template <typename E1, typename E2>
+    [[nodiscard]] constexpr bool operator<=(const Unexpected<E1>& X, const Unexpected<E2>& Y) noexcept(noexcept(Y < X)) {
+        return !(Y < X);
+    }
+
+    template <typename E1, typename E2>
+    [[nodiscard]] constexpr bool operator>=(const Unexpected<E1>& X, const Unexpected<E2>& Y) noexcept(noexcept(X < Y)) {
+        return !(X < Y);
+    }
+
     template <typename E, typename std::enable_if_t<details::Swappable<E>::value, int> = 0>
-    void swap(Unexpected<E>& X, Unexpected<E>& Y) noexcept(noexcept(X.Swap(Y))) {
+    _EXPECTED_CONSTEXPR20 void swap(Unexpected<E>& X, Unexpected<E>& Y) noexcept(noexcept(X.Swap(Y))) {
         X.Swap(Y);
     }
+}
+
+namespace stdx::details {
+    template <typename E>
+    struct UnexpectedHash {
+        std::size_t operator()(const Unexpected<E>& Unex) const noexcept(noexcept(std::hash<E>()(Unex.Value()))) {
+            return std::hash<E>()(Unex.Value());
+        }
+    };
+}
+
+namespace std {
+    template <typename E>
+    struct hash<stdx::Unexpected<E>> :
+        stdx::details::Conditional<stdx::details::Hashable<E>, stdx::details::UnexpectedHash<E>, stdx::details::DisabledHash> {};
 }
\ No newline at end of file
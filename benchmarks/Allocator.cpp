@@ -0,0 +1,54 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::benchmarks {
+    using Result = Expected<std::pmr::string, std::pmr::string>;
+
+    constexpr std::size_t RequestsPerBatch = 256;
+
+    // Parses the requests of a batch into results kept for the rest of it, one in 8 failing with a message: the strings
+    // of both alternatives are long enough to allocate, from whatever resource the vector hands down.
+    void ProcessBatch(std::pmr::memory_resource* Resource, std::int64_t& Next) {
+        std::pmr::vector<Result> Results(Resource);
+        Results.reserve(RequestsPerBatch);
+        for (std::size_t I = 0; I < RequestsPerBatch; ++I, ++Next) {
+            if (Next % 8 == 0) {
+                Results.emplace_back(unexpect, "request rejected by the upstream service: ").Error() += std::to_string(Next);
+            } else {
+                Results.emplace_back("a response body long enough to need the heap: ").Value() += std::to_string(Next);
+            }
+        }
+        benchmark::DoNotOptimize(Results.data());
+        benchmark::ClobberMemory();
+    }
+
+    void DefaultResource(benchmark::State& State) {
+        std::int64_t Next = 0;
+        while (State.KeepRunningBatch(RequestsPerBatch)) {
+            ProcessBatch(std::pmr::get_default_resource(), Next);
+        }
+        State.SetItemsProcessed(State.iterations());
+    }
+
+    // The results of a batch come out of a buffer released once the batch is done.
+    void Arena(benchmark::State& State) {
+        alignas(std::max_align_t) static unsigned char Buffer[64 * 1024];
+        std::pmr::monotonic_buffer_resource Resource(Buffer, sizeof(Buffer), std::pmr::null_memory_resource());
+        std::int64_t Next = 0;
+        while (State.KeepRunningBatch(RequestsPerBatch)) {
+            ProcessBatch(&Resource, Next);
+            Resource.release();
+        }
+        State.SetItemsProcessed(State.iterations());
+    }
+
+    BENCHMARK(DefaultResource);
+    BENCHMARK(Arena);
+}
@@ -0,0 +1,127 @@
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/ExpectedBatch.hpp>
+
+#include "Models.hpp"
+
+namespace stdx::benchmarks {
+    // One element in every 16 holds an error, as in MakeSample.
+    template <typename Container>
+    Container MakeResults(std::size_t Count) {
+        Container Results;
+        Results.reserve(Count);
+        for (std::size_t I = 0; I < Count; ++I) {
+            if (I % 16 == 0) {
+                Results.push_back(Expected<double, ErrorCode>(unexpect, ErrorCode::Timeout));
+            } else {
+                Results.push_back(Expected<double, ErrorCode>(double(I)));
+            }
+        }
+        return Results;
+    }
+
+    struct BatchBuilder : ExpectedBatch<double, ErrorCode> {
+        void reserve(std::size_t Count) {
+            Reserve(Count);
+        }
+
+        void push_back(Expected<double, ErrorCode>&& X) {
+            PushBack(std::move(X));
+        }
+    };
+
+    // Sums the successes, which is what a consumer ignoring failures does.
+    void SumValuesVector(benchmark::State& State) {
+        const auto Results = MakeResults<std::vector<Expected<double, ErrorCode>>>(std::size_t(State.range(0)));
+
+        for (auto _ : State) {
+            double Sum = 0;
+            for (const auto& X : Results) {
+                if (X.HasValue()) {
+                    Sum += *X;
+                }
+            }
+            benchmark::DoNotOptimize(Sum);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * State.range(0));
+    }
+
+    void SumValuesBatch(benchmark::State& State) {
+        const auto Results = MakeResults<BatchBuilder>(std::size_t(State.range(0)));
+
+        for (auto _ : State) {
+            double Sum = 0;
+            for (double Value : Results.Values()) {
+                Sum += Value;
+            }
+            benchmark::DoNotOptimize(Sum);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * State.range(0));
+    }
+
+    void CountErrorsVector(benchmark::State& State) {
+        const auto Results = MakeResults<std::vector<Expected<double, ErrorCode>>>(std::size_t(State.range(0)));
+
+        for (auto _ : State) {
+            std::size_t Count = 0;
+            for (const auto& X : Results) {
+                Count += !X.HasValue();
+            }
+            benchmark::DoNotOptimize(Count);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * State.range(0));
+    }
+
+    // Recounts from the bitmap rather than reading CountErrors(), to measure the scan itself.
+    void CountErrorsBatch(benchmark::State& State) {
+        const auto Results = MakeResults<BatchBuilder>(std::size_t(State.range(0)));
+        const std::size_t Words = (Results.Size() + 63) / 64;
+
+        for (auto _ : State) {
+            std::size_t Count = Results.Size();
+            for (std::size_t I = 0; I < Words; ++I) {
+                Count -= details::PopCount(Results.BitmapWord(I));
+            }
+            benchmark::DoNotOptimize(Count);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * State.range(0));
+    }
+
+    void RandomAccessVector(benchmark::State& State) {
+        const auto Results = MakeResults<std::vector<Expected<double, ErrorCode>>>(std::size_t(State.range(0)));
+        const std::size_t Mask = Results.size() - 1;
+
+        for (auto _ : State) {
+            double Sum = 0;
+            for (std::size_t I = 0, J = 0; I < 1024; ++I, J = (J * 5 + 1) & Mask) {
+                Sum += Results[J].ValueOr(0.0);
+            }
+            benchmark::DoNotOptimize(Sum);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * 1024);
+    }
+
+    void RandomAccessBatch(benchmark::State& State) {
+        const auto Results = MakeResults<BatchBuilder>(std::size_t(State.range(0)));
+        const std::size_t Mask = Results.Size() - 1;
+
+        for (auto _ : State) {
+            double Sum = 0;
+            for (std::size_t I = 0, J = 0; I < 1024; ++I, J = (J * 5 + 1) & Mask) {
+                Sum += Results[J].ValueOr(0.0);
+            }
+            benchmark::DoNotOptimize(Sum);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * 1024);
+    }
+
+    BENCHMARK(SumValuesVector)->Range(1 << 10, 1 << 20);
+    BENCHMARK(SumValuesBatch)->Range(1 << 10, 1 << 20);
+    BENCHMARK(CountErrorsVector)->Range(1 << 10, 1 << 20);
+    BENCHMARK(CountErrorsBatch)->Range(1 << 10, 1 << 20);
+    BENCHMARK(RandomAccessVector)->Range(1 << 10, 1 << 20);
+    BENCHMARK(RandomAccessBatch)->Range(1 << 10, 1 << 20);
+}
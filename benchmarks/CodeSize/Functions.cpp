@@ -0,0 +1,69 @@
+// Representative uses of Expected, one out-of-line function each, whose object code size is reported by
+// ReportCodeSize.cmake (the expected-code-size target). They cover the value access that may throw and every
+// assignment that has to roll back when a constructor throws, for small and heap-owning alternatives.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::codesize {
+    enum class ErrCode : std::int32_t { Timeout = 1, Refused, Reset };
+
+    // Copying and moving may throw, which takes the assignments through their rollback paths. The constructors are
+    // only declared so that the compiler cannot prove otherwise; the object file is never linked.
+    struct Fragile {
+        Fragile(const std::string& S);
+        Fragile(const Fragile& Other);
+        Fragile(Fragile&& Other) noexcept(false);
+        Fragile& operator=(const Fragile& Other) = default;
+        Fragile& operator=(Fragile&& Other) noexcept(false) = default;
+
+        std::string S;
+    };
+
+    int ValueInt(const Expected<int, ErrCode>& Input) {
+        return Input.Value();
+    }
+
+    std::size_t ValueString(const Expected<std::string, std::string>& Input) {
+        return Input.Value().size();
+    }
+
+    std::string TakeValueString(Expected<std::string, std::string>&& Input) {
+        return std::move(Input).Value();
+    }
+
+    void ValueVoid(const Expected<void, std::string>& Input) {
+        Input.Value();
+    }
+
+    std::size_t ValueVector(Expected<std::vector<int>, std::string>& Input) {
+        return Input.Value().size();
+    }
+
+    void CopyAssignString(Expected<std::string, std::string>& Target, const Expected<std::string, std::string>& Other) {
+        Target = Other;
+    }
+
+    void CopyAssignFragile(Expected<Fragile, std::string>& Target, const Expected<Fragile, std::string>& Other) {
+        Target = Other;
+    }
+
+    void AssignValueFragile(Expected<Fragile, std::string>& Target, const std::string& Value) {
+        Target = Value;
+    }
+
+    void EmplaceFragile(Expected<Fragile, std::string>& Target, const std::string& Value) {
+        Target.Emplace(Value);
+    }
+
+    void SwapFragile(Expected<Fragile, std::string>& X, Expected<Fragile, std::string>& Y) {
+        X.Swap(Y);
+    }
+
+    void AssignErrorReference(Expected<std::string&, Fragile>& Target, const Fragile& Error) {
+        Target = Unexpected(Error);
+    }
+}
@@ -0,0 +1,102 @@
+# Reports the object code size of every stdx function in an object file built with -ffunction-sections.
+#
+#   cmake -DOBJDUMP=<objdump> -DOBJECT=<object file> -P ReportCodeSize.cmake
+#
+# Each function is listed with the bytes it takes in the hot text and in .text.unlikely, where the compiler moves the
+# parts it knows to be cold (".cold" clones, functions declared cold). The hot column is what the callers pay in
+# instruction cache; the totals only add up the functions of the stdx::codesize namespace, see Functions.cpp.
+
+cmake_minimum_required(VERSION 3.15) # string(REPEAT)
+
+foreach (Variable OBJDUMP OBJECT)
+    if (NOT DEFINED ${Variable})
+        message(FATAL_ERROR "${Variable} is not set")
+    endif ()
+endforeach ()
+
+execute_process(
+        COMMAND ${OBJDUMP} -t -C ${OBJECT}
+        OUTPUT_VARIABLE Symbols
+        RESULT_VARIABLE Result)
+if (NOT Result EQUAL 0)
+    message(FATAL_ERROR "${OBJDUMP} failed on ${OBJECT}")
+endif ()
+
+string(REPLACE ";" "\;" Symbols "${Symbols}")
+string(REPLACE "\n" ";" Lines "${Symbols}")
+
+# With -ffunction-sections every function, and the cold part split off it, lives in a section named after the mangled
+# name of the function. Aliases (e.g. the complete and base object destructors) share a section and are counted once.
+set(Functions "")
+foreach (Line IN LISTS Lines)
+    if (NOT Line MATCHES "^[0-9a-f]+ [^\t]* F (\\.text[^ \t]*)\t([0-9a-f]+) (.*)$")
+        continue()
+    endif ()
+    set(Section ${CMAKE_MATCH_1})
+    set(Name "${CMAKE_MATCH_3}")
+    math(EXPR Size "0x${CMAKE_MATCH_2}")
+    if (NOT Name MATCHES "stdx::" OR Name MATCHES "^std::")
+        continue()
+    endif ()
+
+    if (Section MATCHES "^\\.text\\.unlikely\\.(.+)$")
+        set(Kind Cold)
+    elseif (Section MATCHES "^\\.text\\.(.+)$")
+        set(Kind Hot)
+    else ()
+        continue()
+    endif ()
+    string(MAKE_C_IDENTIFIER "${CMAKE_MATCH_1}" Key)
+    if (DEFINED Seen_${Kind}_${Key})
+        continue()
+    endif ()
+    set(Seen_${Kind}_${Key} TRUE)
+
+    if (NOT Key IN_LIST Functions)
+        list(APPEND Functions ${Key})
+        set(Hot_${Key} 0)
+        set(Cold_${Key} 0)
+    endif ()
+    set(${Kind}_${Key} ${Size})
+    # The split-off parts and the specialized copies of a function are named after it, with a [clone] suffix.
+    if (NOT Name MATCHES " \\[clone [^]]*\\]$" OR NOT DEFINED Name_${Key})
+        string(REGEX REPLACE " \\[clone [^]]*\\]$" "" Name "${Name}")
+        string(REPLACE "std::__cxx11::basic_string<char, std::char_traits<char>, std::allocator<char> >" "std::string" Name "${Name}")
+        string(REPLACE "std::string >" "std::string>" Name "${Name}")
+        set(Name_${Key} "${Name}")
+    endif ()
+endforeach ()
+
+if (NOT Functions)
+    message(FATAL_ERROR "no stdx function found in ${OBJECT}")
+endif ()
+
+set(Rows "")
+set(TotalHot 0)
+set(TotalCold 0)
+foreach (Key IN LISTS Functions)
+    if (Name_${Key} MATCHES "^stdx::codesize::")
+        math(EXPR TotalHot "${TotalHot} + ${Hot_${Key}}")
+        math(EXPR TotalCold "${TotalCold} + ${Cold_${Key}}")
+    endif ()
+    # Zero-padded so that the rows sort by hot size.
+    string(LENGTH "${Hot_${Key}}" Digits)
+    math(EXPR Padding "8 - ${Digits}")
+    string(REPEAT "0" ${Padding} Zeros)
+    list(APPEND Rows "${Zeros}${Hot_${Key}}|${Key}")
+endforeach ()
+list(SORT Rows ORDER DESCENDING)
+
+set(Report "\n     hot    cold  function\n")
+foreach (Row IN LISTS Rows)
+    string(REGEX REPLACE "^[0-9]+\\|" "" Key "${Row}")
+    string(LENGTH "${Hot_${Key}}" HotDigits)
+    string(LENGTH "${Cold_${Key}}" ColdDigits)
+    math(EXPR HotPadding "8 - ${HotDigits}")
+    math(EXPR ColdPadding "8 - ${ColdDigits}")
+    string(REPEAT " " ${HotPadding} HotSpaces)
+    string(REPEAT " " ${ColdPadding} ColdSpaces)
+    string(APPEND Report "${HotSpaces}${Hot_${Key}}${ColdSpaces}${Cold_${Key}}  ${Name_${Key}}\n")
+endforeach ()
+string(APPEND Report "\nstdx::codesize total: ${TotalHot} bytes hot, ${TotalCold} bytes cold\n")
+message(STATUS "${Report}")
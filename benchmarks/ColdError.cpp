@@ -0,0 +1,68 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/ColdError.hpp>
+#include <Expected/Expected.hpp>
+
+namespace stdx::benchmarks {
+    // About 200 bytes of diagnostics, against a 16-byte value.
+    struct Diagnostics {
+        std::int32_t Code;
+        std::int32_t Line;
+        char Message[192];
+    };
+
+    struct Quote {
+        std::int64_t Id;
+        double Price;
+    };
+
+    Diagnostics Diagnose(std::int64_t Id) noexcept {
+        Diagnostics Result;
+        Result.Code = 404;
+        Result.Line = std::int32_t(Id);
+        std::memcpy(Result.Message, "no quote for the requested instrument", 38);
+        return Result;
+    }
+
+    // Fails for ErrorsPer100k of every 100000 ids, spread evenly.
+    template <typename E>
+    [[gnu::noinline]] Expected<Quote, E> Lookup(std::int64_t Id, std::int64_t ErrorsPer100k) {
+        if (Id % 100000 < ErrorsPer100k) {
+            return Unexpected(Diagnose(Id));
+        }
+        return Quote{Id, double(Id) * 0.25};
+    }
+
+    // Fills an array of results from the hot path and sums it, as a batch of lookups does. The argument is the number
+    // of failures per 100000 calls.
+    template <typename E>
+    void Quotes(benchmark::State& State) {
+        constexpr std::size_t Count = 1 << 15;
+        const std::int64_t ErrorsPer100k = State.range(0);
+        std::vector<Expected<Quote, E>> Results;
+        Results.reserve(Count);
+
+        std::int64_t Next = 0;
+        for (auto _ : State) {
+            Results.clear();
+            for (std::size_t I = 0; I < Count; ++I) {
+                Results.push_back(Lookup<E>(Next++ * 7919 % 100000, ErrorsPer100k));
+            }
+            double Sum = 0;
+            for (const Expected<Quote, E>& Result : Results) {
+                Sum += Result.HasValue() ? Result->Price : 0.0;
+            }
+            benchmark::DoNotOptimize(Sum);
+        }
+        State.SetItemsProcessed(State.iterations() * std::int64_t(Count));
+        State.counters["sizeof"] = double(sizeof(Expected<Quote, E>));
+    }
+
+    BENCHMARK_TEMPLATE(Quotes, Diagnostics)->Arg(100)->Arg(10000);
+    BENCHMARK_TEMPLATE(Quotes, ColdError<Diagnostics>)->Arg(100)->Arg(10000);
+}
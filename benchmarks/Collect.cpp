@@ -0,0 +1,66 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/Collect.hpp>
+#include <Expected/ParallelCollect.hpp>
+
+#include "Models.hpp"
+
+namespace stdx::benchmarks {
+    constexpr std::size_t CollectTaskCount = 4096;
+
+    // About a microsecond of work, failing at index FailAt.
+    [[gnu::noinline]] Expected<std::uint64_t, ErrorCode> Simulate(std::size_t Index, std::size_t FailAt) noexcept {
+        if (Index == FailAt) {
+            return Unexpected(ErrorCode::Refused);
+        }
+        std::uint64_t State = Index + 1;
+        for (int Round = 0; Round < 256; ++Round) {
+            State ^= State << 13;
+            State ^= State >> 7;
+            State ^= State << 17;
+        }
+        return State;
+    }
+
+    // The failing index out of the second argument: a percentage of the tasks, or no failure at all past 100.
+    std::size_t FailingIndex(const benchmark::State& State) noexcept {
+        return State.range(1) > 100 ? CollectTaskCount : std::size_t(State.range(1)) * (CollectTaskCount - 1) / 100;
+    }
+
+    // Runs the tasks one after the other and collects their results, the baseline for the parallel version.
+    void CollectSequential(benchmark::State& State) {
+        const std::size_t FailAt = FailingIndex(State);
+        std::vector<Expected<std::uint64_t, ErrorCode>> Results;
+        Results.reserve(CollectTaskCount);
+        for (auto _ : State) {
+            Results.clear();
+            for (std::size_t I = 0; I < CollectTaskCount; ++I) {
+                Results.push_back(Simulate(I, FailAt));
+                if (!Results.back().HasValue()) {
+                    break;
+                }
+            }
+            benchmark::DoNotOptimize(Collect(std::move(Results)));
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * std::int64_t(CollectTaskCount));
+    }
+
+    // The first argument is the number of threads.
+    void CollectParallel(benchmark::State& State) {
+        const std::size_t FailAt = FailingIndex(State);
+        ThreadPool Pool(std::size_t(State.range(0)));
+        for (auto _ : State) {
+            benchmark::DoNotOptimize(ParallelCollect(Pool, CollectTaskCount, [FailAt](std::size_t I) {
+                return Simulate(I, FailAt);
+            }));
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * std::int64_t(CollectTaskCount));
+    }
+
+    BENCHMARK(CollectSequential)->ArgsProduct({{1}, {0, 10, 50, 90, 101}})->UseRealTime();
+    BENCHMARK(CollectParallel)->ArgsProduct({{1, 2, 4, 8, 16, 32, 64}, {0, 10, 50, 90, 101}})->UseRealTime();
+}
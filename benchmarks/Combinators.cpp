@@ -0,0 +1,88 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::benchmarks {
+    struct ParseError {
+        std::string Message;
+        std::size_t Offset;
+    };
+
+    using Parsed = Expected<std::int64_t, ParseError>;
+
+    [[gnu::noinline]] Parsed ParseNumber(const std::string& Text) {
+        std::int64_t Value = 0;
+        for (std::size_t I = 0; I < Text.size(); ++I) {
+            if (Text[I] < '0' || Text[I] > '9') {
+                return Unexpected(ParseError{"unexpected character in request field", I});
+            }
+            Value = Value * 10 + (Text[I] - '0');
+        }
+        return Value;
+    }
+
+    [[gnu::noinline]] Parsed CheckRange(std::int64_t Value) {
+        if (Value > 1000000) {
+            return Unexpected(ParseError{"request field is out of range", 0});
+        }
+        return Value;
+    }
+
+    std::int64_t Scale(std::int64_t Value) {
+        return Value * 3;
+    }
+
+    Parsed Chained(const std::string& Text) {
+        return ParseNumber(Text).AndThen(CheckRange).Transform(Scale).AndThen(CheckRange);
+    }
+
+    Parsed HandUnwrapped(const std::string& Text) {
+        Parsed Number = ParseNumber(Text);
+        if (!Number.HasValue()) {
+            return Unexpected(Number.Error());
+        }
+        Parsed Checked = CheckRange(*Number);
+        if (!Checked.HasValue()) {
+            return Unexpected(Checked.Error());
+        }
+        Parsed Scaled = Scale(*Checked);
+        if (!Scaled.HasValue()) {
+            return Unexpected(Scaled.Error());
+        }
+        return CheckRange(*Scaled);
+    }
+
+    std::vector<std::string> MakeRequests(std::int64_t ErrorPercent) {
+        std::vector<std::string> Requests;
+        for (std::int64_t I = 0; I < 1024; ++I) {
+            if (I % 100 < ErrorPercent) {
+                Requests.push_back(I % 2 == 0 ? "12x4" : "99999999");
+            } else {
+                Requests.push_back(std::to_string(I * 7));
+            }
+        }
+        return Requests;
+    }
+
+    template <Parsed (*Pipeline)(const std::string&)>
+    void ParsePipeline(benchmark::State& State) {
+        const auto Requests = MakeRequests(State.range(0));
+
+        for (auto _ : State) {
+            std::int64_t Sum = 0;
+            for (const auto& Request : Requests) {
+                Parsed Result = Pipeline(Request);
+                Sum += Result.HasValue() ? *Result : std::int64_t(Result.Error().Offset);
+            }
+            benchmark::DoNotOptimize(Sum);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * std::int64_t(Requests.size()));
+    }
+
+    BENCHMARK_TEMPLATE(ParsePipeline, Chained)->Arg(0)->Arg(10)->Arg(50);
+    BENCHMARK_TEMPLATE(ParsePipeline, HandUnwrapped)->Arg(0)->Arg(10)->Arg(50);
+}
@@ -0,0 +1,80 @@
+// Instantiates Expected for STDX_INSTANTIATIONS distinct pairs of types and uses every special member of each, so that
+// the front-end cost of a specialization can be measured with -fsyntax-only. Defining STDX_BASELINE builds the same
+// types and functions without Expected, which is subtracted from the measurement. See MeasureCompileTime.cmake.
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#if !defined(STDX_BASELINE)
+#include <Expected/Expected.hpp>
+#endif
+
+#if !defined(STDX_INSTANTIATIONS)
+#define STDX_INSTANTIATIONS 1000
+#endif
+
+namespace stdx::benchmarks {
+    template <std::size_t I>
+    struct Value {
+        int X = 0;
+
+        friend bool operator==(const Value& A, const Value& B) noexcept {
+            return A.X == B.X;
+        }
+    };
+
+    template <std::size_t I>
+    struct NonTrivial {
+        std::string S;
+
+        friend bool operator==(const NonTrivial& A, const NonTrivial& B) noexcept {
+            return A.S == B.S;
+        }
+    };
+
+    template <std::size_t I>
+    struct Error {
+        int Code = 0;
+
+        friend bool operator==(const Error& A, const Error& B) noexcept {
+            return A.Code == B.Code;
+        }
+    };
+
+    // Even specializations are trivial, odd ones go through the non-trivial special members.
+    template <std::size_t I>
+    using ValueType = std::conditional_t<I % 2 == 0, Value<I>, NonTrivial<I>>;
+
+    template <std::size_t I>
+    bool Touch() {
+#if defined(STDX_BASELINE)
+        ValueType<I> A{};
+        ValueType<I> B = A;
+        ValueType<I> C{};
+        B = A;
+        B = std::move(C);
+        std::swap(B, C);
+        Error<I> D{};
+        return (B == C) && (D == Error<I>{});
+#else
+        Expected<ValueType<I>, Error<I>> A(std::in_place);
+        Expected<ValueType<I>, Error<I>> B = A;
+        Expected<ValueType<I>, Error<I>> C(unexpect);
+        B = A;
+        B = std::move(C);
+        C.Swap(B);
+        return B.HasValue() == A.HasValue() && B == C;
+#endif
+    }
+
+    template <std::size_t... Is>
+    bool TouchAll(std::index_sequence<Is...>) {
+        return (Touch<Is>() & ...);
+    }
+
+    bool Instantiate() {
+        return TouchAll(std::make_index_sequence<STDX_INSTANTIATIONS>());
+    }
+}
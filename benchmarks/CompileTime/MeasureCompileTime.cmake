@@ -0,0 +1,90 @@
+# Measures the front-end cost of an Expected specialization.
+#
+#   cmake -DCOMPILER=<c++ compiler> -DCOMPILER_ID=<GNU|Clang> -DSOURCE=<Instantiations.cpp> -DINCLUDE_DIR=<Public>
+#         -DSTANDARDS=<17;20> -DINSTANTIATIONS=<count> [-DREPETITIONS=<count>] -P MeasureCompileTime.cmake
+#
+# SOURCE is checked with -fsyntax-only once as is and once with STDX_BASELINE defined, for every standard in STANDARDS.
+# The difference between the two is reported per instantiation. Wall time is the best of REPETITIONS runs. Memory is
+# the garbage-collected heap reported by GCC's -ftime-report, which is deterministic, and is not available elsewhere.
+
+cmake_minimum_required(VERSION 3.23) # string(TIMESTAMP) with %f
+
+foreach (Variable COMPILER COMPILER_ID SOURCE INCLUDE_DIR STANDARDS INSTANTIATIONS)
+    if (NOT DEFINED ${Variable})
+        message(FATAL_ERROR "${Variable} is not set")
+    endif ()
+endforeach ()
+
+if (NOT DEFINED REPETITIONS)
+    set(REPETITIONS 1)
+endif ()
+
+# Sets <Prefix>_Time to the best wall time in microseconds and <Prefix>_Memory to the heap size in kilobytes (or "").
+function(Measure Prefix Standard)
+    set(Command ${COMPILER} -std=c++${Standard} -fsyntax-only -I${INCLUDE_DIR} -DSTDX_INSTANTIATIONS=${INSTANTIATIONS})
+    if (COMPILER_ID STREQUAL "GNU")
+        list(APPEND Command -ftime-report)
+    endif ()
+    list(APPEND Command ${ARGN} ${SOURCE})
+
+    set(BestTime "")
+    set(Memory "")
+    foreach (Repetition RANGE 1 ${REPETITIONS})
+        string(TIMESTAMP Start "%s%f" UTC)
+        execute_process(COMMAND ${Command} RESULT_VARIABLE Result OUTPUT_VARIABLE Output ERROR_VARIABLE Output)
+        string(TIMESTAMP Stop "%s%f" UTC)
+        if (NOT Result EQUAL 0)
+            message(FATAL_ERROR "${Command} failed:\n${Output}")
+        endif ()
+
+        math(EXPR Time "${Stop} - ${Start}")
+        if (BestTime STREQUAL "" OR Time LESS BestTime)
+            set(BestTime ${Time})
+        endif ()
+
+        if (Output MATCHES "TOTAL[^\n]* ([0-9]+)([kMG]) *\n")
+            set(Memory ${CMAKE_MATCH_1})
+            if (CMAKE_MATCH_2 STREQUAL "M")
+                math(EXPR Memory "${Memory} * 1024")
+            elseif (CMAKE_MATCH_2 STREQUAL "G")
+                math(EXPR Memory "${Memory} * 1024 * 1024")
+            endif ()
+        endif ()
+    endforeach ()
+
+    set(${Prefix}_Time ${BestTime} PARENT_SCOPE)
+    set(${Prefix}_Memory ${Memory} PARENT_SCOPE)
+endfunction()
+
+# Formats Value / Divisor with two decimals.
+function(Divide Out Value Divisor)
+    math(EXPR Hundredths "${Value} * 100 / (${Divisor})")
+    math(EXPR Whole "${Hundredths} / 100")
+    math(EXPR Fraction "${Hundredths} % 100")
+    if (Fraction LESS 10)
+        set(Fraction "0${Fraction}")
+    endif ()
+    set(${Out} "${Whole}.${Fraction}" PARENT_SCOPE)
+endfunction()
+
+foreach (Standard IN LISTS STANDARDS)
+    Measure(Baseline ${Standard} -DSTDX_BASELINE)
+    Measure(Expected ${Standard})
+
+    math(EXPR Time "${Expected_Time} - ${Baseline_Time}")
+    if (Time LESS 0)
+        set(Time 0)
+    endif ()
+    math(EXPR Milliseconds "${Time} / 1000")
+    Divide(TimePerInstantiation ${Time} "${INSTANTIATIONS} * 1000")
+    set(Report "C++${Standard}: ${INSTANTIATIONS} instantiations, ${Milliseconds} ms (${TimePerInstantiation} ms each)")
+
+    if (NOT Expected_Memory STREQUAL "" AND NOT Baseline_Memory STREQUAL "")
+        math(EXPR Memory "${Expected_Memory} - ${Baseline_Memory}")
+        math(EXPR Megabytes "${Memory} / 1024")
+        Divide(MemoryPerInstantiation ${Memory} ${INSTANTIATIONS})
+        string(APPEND Report ", ${Megabytes} MB (${MemoryPerInstantiation} kB each)")
+    endif ()
+
+    message(STATUS "${Report}")
+endforeach ()
@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::benchmarks {
+    enum class ErrCode : std::int32_t { Timeout, Refused, Reset };
+
+    struct RawResult {
+        int Value;
+        ErrCode Error;
+        bool bHasValue;
+    };
+
+    template <typename T>
+    std::vector<T> MakeResults(std::size_t Count) {
+        std::vector<T> Results;
+        Results.reserve(Count);
+        for (std::size_t I = 0; I < Count; ++I) {
+            if constexpr (std::is_same_v<T, RawResult>) {
+                Results.push_back(RawResult{int(I), ErrCode::Timeout, I % 16 != 0});
+            } else if (I % 16 != 0) {
+                Results.emplace_back(int(I));
+            } else {
+                Results.emplace_back(unexpect, ErrCode::Timeout);
+            }
+        }
+        return Results;
+    }
+
+    template <typename T>
+    void BulkCopy(benchmark::State& State) {
+        const auto Count = std::size_t(State.range(0));
+        const std::vector<T> Source = MakeResults<T>(Count);
+        std::vector<T> Destination = Source;
+
+        for (auto _ : State) {
+            std::copy(Source.begin(), Source.end(), Destination.begin());
+            benchmark::DoNotOptimize(Destination.data());
+            benchmark::ClobberMemory();
+        }
+        State.SetBytesProcessed(std::int64_t(State.iterations()) * std::int64_t(Count * sizeof(T)));
+    }
+
+    template <typename T>
+    void VectorCopyConstruct(benchmark::State& State) {
+        const auto Count = std::size_t(State.range(0));
+        const std::vector<T> Source = MakeResults<T>(Count);
+
+        for (auto _ : State) {
+            std::vector<T> Destination(Source);
+            benchmark::DoNotOptimize(Destination.data());
+        }
+        State.SetBytesProcessed(std::int64_t(State.iterations()) * std::int64_t(Count * sizeof(T)));
+    }
+
+    BENCHMARK_TEMPLATE(BulkCopy, RawResult)->Range(1 << 10, 1 << 20);
+    BENCHMARK_TEMPLATE(BulkCopy, Expected<int, ErrCode>)->Range(1 << 10, 1 << 20);
+    BENCHMARK_TEMPLATE(VectorCopyConstruct, RawResult)->Range(1 << 10, 1 << 20);
+    BENCHMARK_TEMPLATE(VectorCopyConstruct, Expected<int, ErrCode>)->Range(1 << 10, 1 << 20);
+}
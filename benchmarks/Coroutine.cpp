@@ -0,0 +1,82 @@
+#include <cstdint>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/Coroutine.hpp>
+
+#if defined(STDX_EXPECTED_HAS_COROUTINES)
+namespace stdx::benchmarks {
+    enum class StageError : std::int32_t { Rejected = 1 };
+
+    using Result = Expected<std::int64_t, StageError>;
+
+    Result Leaf(std::int64_t Input) noexcept {
+        if (Input % 16 == 0) {
+            return Unexpected(StageError::Rejected);
+        }
+        return Input;
+    }
+
+    [[gnu::noinline]] Result Manual(std::int64_t Input, int Depth) noexcept {
+        if (Depth == 0) {
+            return Leaf(Input);
+        }
+        Result Inner = Manual(Input, Depth - 1);
+        if (!Inner.HasValue()) {
+            return Unexpected(Inner.Error());
+        }
+        return *Inner + 1;
+    }
+
+    // Frames come from the per-thread frame stack.
+    [[gnu::noinline]] Result Awaited(std::int64_t Input, int Depth) {
+        if (Depth == 0) {
+            co_return Leaf(Input);
+        }
+        co_return co_await Awaited(Input, Depth - 1) + 1;
+    }
+
+    // An empty arena sends every frame to the global operator new, which is what an unelided coroutine costs.
+    [[gnu::noinline]] Result AwaitedOnHeap(std::allocator_arg_t, CoroutineArena& Arena, std::int64_t Input, int Depth) {
+        if (Depth == 0) {
+            co_return Leaf(Input);
+        }
+        co_return co_await AwaitedOnHeap(std::allocator_arg, Arena, Input, Depth - 1) + 1;
+    }
+
+    template <typename F>
+    void Run(benchmark::State& State, F&& Call) {
+        const auto Depth = int(State.range(0));
+
+        for (auto _ : State) {
+            std::int64_t Sum = 0;
+            for (std::int64_t I = 0; I < 1024; ++I) {
+                Result R = Call(I, Depth);
+                Sum += R.HasValue() ? *R : 1;
+            }
+            benchmark::DoNotOptimize(Sum);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * 1024);
+    }
+
+    void PropagateManual(benchmark::State& State) {
+        Run(State, Manual);
+    }
+
+    void PropagateCoAwait(benchmark::State& State) {
+        Run(State, Awaited);
+    }
+
+    void PropagateCoAwaitHeap(benchmark::State& State) {
+        CoroutineArena Empty;
+        Run(State, [&](std::int64_t Input, int Depth) {
+            return AwaitedOnHeap(std::allocator_arg, Empty, Input, Depth);
+        });
+    }
+
+    BENCHMARK(PropagateManual)->RangeMultiplier(2)->Range(1, 16);
+    BENCHMARK(PropagateCoAwait)->RangeMultiplier(2)->Range(1, 16);
+    BENCHMARK(PropagateCoAwaitHeap)->RangeMultiplier(2)->Range(1, 16);
+}
+#endif
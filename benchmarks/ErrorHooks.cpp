@@ -0,0 +1,53 @@
+#include <cstdint>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/Expected.hpp>
+
+// Built twice: into expected-bench as is, and into expected-bench-hooks with STDX_EXPECTED_ERROR_HOOKS defined. The
+// difference between the two runs is the overhead of the hooks.
+namespace stdx::benchmarks {
+    enum class HookError : std::int32_t { Refused = 1, Timeout };
+
+    // One failure in FailureEvery calls, from one of two sites.
+    [[gnu::noinline]] Expected<std::int64_t, HookError> Connect(std::int64_t Input, std::int64_t FailureEvery) {
+        if (Input % FailureEvery == 0) {
+            if (Input % 2 == 0) {
+                return Unexpected(HookError::Refused);
+            }
+            return Expected<std::int64_t, HookError>(unexpect, HookError::Timeout);
+        }
+        return Input * 3;
+    }
+
+    [[gnu::noinline]] Expected<std::string, std::string> Resolve(std::int64_t Input, std::int64_t FailureEvery) {
+        if (Input % FailureEvery == 0) {
+            return Unexpected(std::string("no such host"));
+        }
+        return std::string("host");
+    }
+
+    // Argument: one call in that many fails. 1 is an error storm, 1 000 000 the success path alone.
+    void HookedConnect(benchmark::State& State) {
+        const std::int64_t FailureEvery = State.range(0);
+        std::int64_t Input = std::int64_t(State.thread_index()) << 32;
+        for (auto _ : State) {
+            benchmark::DoNotOptimize(Connect(++Input, FailureEvery));
+        }
+        State.SetItemsProcessed(State.iterations());
+    }
+
+    void HookedResolve(benchmark::State& State) {
+        const std::int64_t FailureEvery = State.range(0);
+        std::int64_t Input = 0;
+        for (auto _ : State) {
+            benchmark::DoNotOptimize(Resolve(++Input, FailureEvery));
+        }
+        State.SetItemsProcessed(State.iterations());
+    }
+
+    BENCHMARK(HookedConnect)->Arg(1)->Arg(16)->Arg(1000000);
+    BENCHMARK(HookedConnect)->Arg(1)->ThreadRange(2, 8)->UseRealTime();
+    BENCHMARK(HookedResolve)->Arg(1)->Arg(1000000);
+}
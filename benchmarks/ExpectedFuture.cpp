@@ -0,0 +1,215 @@
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/ExpectedFuture.hpp>
+
+#include "Models.hpp"
+
+namespace stdx::benchmarks {
+    // The two channels compared, behind the same interface.
+    template <typename T>
+    struct LightChannel {
+        using Promise = ExpectedPromise<T, ErrorCode>;
+        using Future = ExpectedFuture<T, ErrorCode>;
+
+        static Future FutureOf(Promise& P) {
+            return P.GetFuture();
+        }
+
+        template <typename U>
+        static void SetValue(Promise& P, U&& Value) {
+            P.SetValue(std::forward<U>(Value));
+        }
+
+        static void SetError(Promise& P, ErrorCode Error) {
+            P.SetError(Error);
+        }
+
+        static Expected<T, ErrorCode> Get(Future& F) {
+            return F.Get();
+        }
+    };
+
+    template <typename T>
+    struct StdChannel {
+        using Promise = std::promise<Expected<T, ErrorCode>>;
+        using Future = std::future<Expected<T, ErrorCode>>;
+
+        static Future FutureOf(Promise& P) {
+            return P.get_future();
+        }
+
+        template <typename U>
+        static void SetValue(Promise& P, U&& Value) {
+            P.set_value(Expected<T, ErrorCode>(std::forward<U>(Value)));
+        }
+
+        static void SetError(Promise& P, ErrorCode Error) {
+            P.set_value(Unexpected(Error));
+        }
+
+        static Expected<T, ErrorCode> Get(Future& F) {
+            return F.get();
+        }
+    };
+
+    // Creates a channel, sets and gets its result on the same thread: the cost of the channel itself, without the
+    // thread switches of the benchmarks below.
+    template <template <typename> class Channel>
+    void Handoff(benchmark::State& State) {
+        using Outbox = Channel<std::int64_t>;
+
+        std::int64_t Value = 0;
+        for (auto _ : State) {
+            typename Outbox::Promise Reply;
+            typename Outbox::Future Replied = Outbox::FutureOf(Reply);
+            Outbox::SetValue(Reply, ++Value);
+            benchmark::DoNotOptimize(Outbox::Get(Replied));
+        }
+        State.SetItemsProcessed(State.iterations());
+    }
+
+    // A request sent to a worker, with the promise for its reply.
+    template <template <typename> class Channel>
+    struct Request {
+        std::int64_t Value;
+        typename Channel<std::int64_t>::Promise Reply;
+    };
+
+    // Requests are handed to the workers over channels of their own, created ahead of each batch of rounds so that
+    // only the reply channels, the ones measured, are created while timing.
+    constexpr std::size_t RoundsPerBatch = 256;
+
+    template <template <typename> class Channel>
+    struct Inboxes {
+        using Inbox = Channel<Request<Channel>>;
+
+        explicit Inboxes(std::size_t Rounds) : Sends(Rounds) {
+            for (typename Inbox::Promise& Send : Sends) {
+                Receives.push_back(Inbox::FutureOf(Send));
+            }
+        }
+
+        std::vector<typename Inbox::Promise> Sends;
+        std::vector<typename Inbox::Future> Receives;
+    };
+
+    // Answers every request of a batch, failing one in 16.
+    template <template <typename> class Channel>
+    void Serve(std::vector<typename Channel<Request<Channel>>::Future>& Receives) {
+        using Inbox = Channel<Request<Channel>>;
+        using Outbox = Channel<std::int64_t>;
+
+        for (typename Inbox::Future& Receive : Receives) {
+            Expected<Request<Channel>, ErrorCode> Message = Inbox::Get(Receive);
+            if (Message->Value % 16 == 0) {
+                Outbox::SetError(Message->Reply, ErrorCode::Refused);
+            } else {
+                Outbox::SetValue(Message->Reply, Message->Value + 1);
+            }
+        }
+    }
+
+    // Sends a request with a fresh reply channel and returns the future of its reply.
+    template <template <typename> class Channel>
+    typename Channel<std::int64_t>::Future Post(
+        typename Channel<Request<Channel>>::Promise& Send, typename Channel<std::int64_t>::Promise Reply, std::int64_t Value) {
+        using Inbox = Channel<Request<Channel>>;
+        using Outbox = Channel<std::int64_t>;
+
+        typename Outbox::Future Replied = Outbox::FutureOf(Reply);
+        Inbox::SetValue(Send, Request<Channel>{Value, std::move(Reply)});
+        return Replied;
+    }
+
+    // Round trips between this thread and a worker, a new reply channel for each, as a thread handing work to another
+    // does.
+    template <template <typename> class Channel>
+    void PingPong(benchmark::State& State) {
+        using Outbox = Channel<std::int64_t>;
+
+        std::int64_t Value = 0;
+        while (State.KeepRunningBatch(RoundsPerBatch)) {
+            State.PauseTiming();
+            Inboxes<Channel> Batch(RoundsPerBatch);
+            std::thread Worker(Serve<Channel>, std::ref(Batch.Receives));
+            State.ResumeTiming();
+
+            for (std::size_t Round = 0; Round < RoundsPerBatch; ++Round) {
+                typename Outbox::Future Replied = Post<Channel>(Batch.Sends[Round], typename Outbox::Promise(), ++Value);
+                benchmark::DoNotOptimize(Outbox::Get(Replied));
+            }
+
+            State.PauseTiming();
+            Worker.join();
+            State.ResumeTiming();
+        }
+        State.SetItemsProcessed(State.iterations());
+    }
+
+    // Rounds of one request to each of Argument workers, whose replies this thread gathers. With Arena, the reply slots
+    // come out of a buffer that is reset once all replies of a round are in.
+    template <template <typename> class Channel, bool Arena = false>
+    void FanIn(benchmark::State& State) {
+        using Outbox = Channel<std::int64_t>;
+
+        const std::size_t WorkerCount = std::size_t(State.range(0));
+        alignas(std::max_align_t) unsigned char Buffer[4096];
+        std::pmr::monotonic_buffer_resource Resource(Buffer, sizeof(Buffer));
+        std::vector<typename Outbox::Future> Replies(WorkerCount);
+
+        std::int64_t Value = 0;
+        while (State.KeepRunningBatch(RoundsPerBatch)) {
+            State.PauseTiming();
+            std::vector<Inboxes<Channel>> Batches;
+            Batches.reserve(WorkerCount);
+            std::vector<std::thread> Workers;
+            for (std::size_t I = 0; I < WorkerCount; ++I) {
+                Batches.emplace_back(RoundsPerBatch);
+                Workers.emplace_back(Serve<Channel>, std::ref(Batches.back().Receives));
+            }
+            State.ResumeTiming();
+
+            for (std::size_t Round = 0; Round < RoundsPerBatch; ++Round) {
+                for (std::size_t I = 0; I < WorkerCount; ++I) {
+                    typename Channel<Request<Channel>>::Promise& Send = Batches[I].Sends[Round];
+                    if constexpr (Arena) {
+                        typename Outbox::Promise Reply(std::allocator_arg, std::pmr::polymorphic_allocator<char>(&Resource));
+                        Replies[I] = Post<Channel>(Send, std::move(Reply), ++Value);
+                    } else {
+                        Replies[I] = Post<Channel>(Send, typename Outbox::Promise(), ++Value);
+                    }
+                }
+                for (typename Outbox::Future& Replied : Replies) {
+                    benchmark::DoNotOptimize(Outbox::Get(Replied));
+                }
+                Resource.release();
+            }
+
+            State.PauseTiming();
+            for (std::thread& Worker : Workers) {
+                Worker.join();
+            }
+            State.ResumeTiming();
+        }
+        State.SetItemsProcessed(State.iterations() * State.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(Handoff, LightChannel);
+    BENCHMARK_TEMPLATE(Handoff, StdChannel);
+
+    BENCHMARK_TEMPLATE(PingPong, LightChannel)->UseRealTime();
+    BENCHMARK_TEMPLATE(PingPong, StdChannel)->UseRealTime();
+
+    // Only ExpectedPromise can take its reply slots from an arena reset every round: a std::promise holds on to its
+    // shared state until the promise object itself is destroyed, which the worker may do only after the round is over.
+    BENCHMARK_TEMPLATE(FanIn, LightChannel)->Arg(1)->Arg(4)->UseRealTime();
+    BENCHMARK_TEMPLATE(FanIn, LightChannel, true)->Arg(1)->Arg(4)->UseRealTime();
+    BENCHMARK_TEMPLATE(FanIn, StdChannel)->Arg(1)->Arg(4)->UseRealTime();
+}
@@ -0,0 +1,155 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/ExpectedWire.hpp>
+
+#include "Models.hpp"
+
+namespace stdx::benchmarks {
+    struct WireResponse {
+        std::int64_t Id;
+        double Latency;
+        std::uint32_t Status;
+    };
+
+    using WireResult = Expected<WireResponse, ErrorCode>;
+    using Format = WireFormat<WireResponse, ErrorCode>;
+
+    // One response in every 16 is an error.
+    std::vector<WireResult> MakeResponses(std::size_t Count) {
+        std::vector<WireResult> Responses;
+        Responses.reserve(Count);
+        for (std::size_t I = 0; I < Count; ++I) {
+            if (I % 16 == 0) {
+                Responses.emplace_back(unexpect, ErrorCode::Timeout);
+            } else {
+                Responses.emplace_back(WireResponse{std::int64_t(I), double(I) / 8, 200});
+            }
+        }
+        return Responses;
+    }
+
+    // What a hand-written encoder does: a tag byte, then the fields one after the other, packed.
+    namespace fields {
+        template <typename X>
+        unsigned char* Put(unsigned char* To, const X& Field) noexcept {
+            std::memcpy(To, &Field, sizeof(X));
+            return To + sizeof(X);
+        }
+
+        template <typename X>
+        const unsigned char* Get(const unsigned char* From, X& Field) noexcept {
+            std::memcpy(&Field, From, sizeof(X));
+            return From + sizeof(X);
+        }
+
+        unsigned char* Encode(const WireResult& Result, unsigned char* To) noexcept {
+            *To++ = Result.HasValue() ? 1 : 2;
+            if (Result.HasValue()) {
+                To = Put(To, Result->Id);
+                To = Put(To, Result->Latency);
+                return Put(To, Result->Status);
+            }
+            return Put(To, std::int32_t(Result.Error()));
+        }
+
+        const unsigned char* Decode(const unsigned char* From, WireResult& Result) noexcept {
+            if (*From++ == 1) {
+                WireResponse Response;
+                From = Get(From, Response.Id);
+                From = Get(From, Response.Latency);
+                From = Get(From, Response.Status);
+                Result = Response;
+                return From;
+            }
+            std::int32_t Error;
+            From = Get(From, Error);
+            Result = Unexpected(ErrorCode(Error));
+            return From;
+        }
+    }
+
+    void EncodeFields(benchmark::State& State) {
+        const std::vector<WireResult> Responses = MakeResponses(std::size_t(State.range(0)));
+        std::vector<unsigned char> Buffer(Responses.size() * (1 + sizeof(WireResponse)));
+
+        for (auto _ : State) {
+            unsigned char* To = Buffer.data();
+            for (const WireResult& Response : Responses) {
+                To = fields::Encode(Response, To);
+            }
+            benchmark::DoNotOptimize(To);
+            benchmark::ClobberMemory();
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * State.range(0));
+    }
+
+    void EncodeWire(benchmark::State& State) {
+        const std::vector<WireResult> Responses = MakeResponses(std::size_t(State.range(0)));
+        std::vector<unsigned char> Buffer(Responses.size() * Format::Size);
+
+        for (auto _ : State) {
+            unsigned char* To = Buffer.data();
+            for (const WireResult& Response : Responses) {
+                To += *WriteWire(Response, To, Format::Size);
+            }
+            benchmark::DoNotOptimize(To);
+            benchmark::ClobberMemory();
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * State.range(0));
+    }
+
+    // Both readers sum the ids of the successful responses, as a caller going through a reply batch would.
+    void DecodeFields(benchmark::State& State) {
+        const std::vector<WireResult> Responses = MakeResponses(std::size_t(State.range(0)));
+        std::vector<unsigned char> Buffer(Responses.size() * (1 + sizeof(WireResponse)));
+        unsigned char* To = Buffer.data();
+        for (const WireResult& Response : Responses) {
+            To = fields::Encode(Response, To);
+        }
+
+        for (auto _ : State) {
+            std::int64_t Sum = 0;
+            WireResult Result = Unexpected(ErrorCode::None);
+            const unsigned char* From = Buffer.data();
+            for (std::size_t I = 0; I < Responses.size(); ++I) {
+                From = fields::Decode(From, Result);
+                if (Result.HasValue()) {
+                    Sum += Result->Id;
+                }
+            }
+            benchmark::DoNotOptimize(Sum);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * State.range(0));
+    }
+
+    void ViewWire(benchmark::State& State) {
+        const std::vector<WireResult> Responses = MakeResponses(std::size_t(State.range(0)));
+        std::vector<unsigned char> Buffer(Responses.size() * Format::Size);
+        for (std::size_t I = 0; I < Responses.size(); ++I) {
+            static_cast<void>(WriteWire(Responses[I], Buffer.data() + I * Format::Size, Format::Size));
+        }
+
+        for (auto _ : State) {
+            std::int64_t Sum = 0;
+            const unsigned char* From = Buffer.data();
+            for (std::size_t I = 0; I < Responses.size(); ++I, From += Format::Size) {
+                const auto View = ExpectedView<WireResponse, ErrorCode>::Read(From, Format::Size);
+                if (View.HasValue() && View->HasValue()) {
+                    Sum += (*View)->Id;
+                }
+            }
+            benchmark::DoNotOptimize(Sum);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * State.range(0));
+    }
+
+    BENCHMARK(EncodeFields)->Arg(1024);
+    BENCHMARK(EncodeWire)->Arg(1024);
+    BENCHMARK(DecodeFields)->Arg(1024);
+    BENCHMARK(ViewWire)->Arg(1024);
+}
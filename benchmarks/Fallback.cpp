@@ -0,0 +1,113 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/Expected.hpp>
+
+#include "Models.hpp"
+
+namespace stdx::benchmarks {
+    constexpr int FallbackBatchSize = 1024;
+
+    // Values whose default is expensive to make: a string and a vector too large for any inline buffer.
+    template <typename T>
+    struct Fallbacks;
+
+    template <>
+    struct Fallbacks<std::string> {
+        static std::string Value(int I) {
+            return LongValue + std::to_string(I);
+        }
+
+        static std::string Default() {
+            return std::string(64, 'd');
+        }
+
+        static std::size_t Weight(const std::string& Value) noexcept {
+            return Value.size();
+        }
+    };
+
+    template <>
+    struct Fallbacks<std::vector<std::int64_t>> {
+        static std::vector<std::int64_t> Value(int I) {
+            return std::vector<std::int64_t>(16, I);
+        }
+
+        static std::vector<std::int64_t> Default() {
+            return std::vector<std::int64_t>(16, -1);
+        }
+
+        static std::size_t Weight(const std::vector<std::int64_t>& Value) noexcept {
+            return std::size_t(Value.front());
+        }
+    };
+
+    // One in a hundred results is an error. Each is constructed in place, straight from the value or the error.
+    template <typename T>
+    std::vector<Expected<T, ErrorCode>> MakeResults() {
+        std::vector<Expected<T, ErrorCode>> Results;
+        Results.reserve(FallbackBatchSize);
+        for (int I = 0; I < FallbackBatchSize; ++I) {
+            if (I % 100 == 99) {
+                Results.emplace_back(unexpect, ErrorCode::Timeout);
+            } else {
+                Results.emplace_back(std::in_place, Fallbacks<T>::Value(I));
+            }
+        }
+        return Results;
+    }
+
+    // ValueOr makes the fallback at every call and copies the value out.
+    template <typename T>
+    void EagerValueOr(benchmark::State& State) {
+        const auto Results = MakeResults<T>();
+        for (auto _ : State) {
+            std::size_t Total = 0;
+            for (const Expected<T, ErrorCode>& Result : Results) {
+                Total += Fallbacks<T>::Weight(Result.ValueOr(Fallbacks<T>::Default()));
+            }
+            benchmark::DoNotOptimize(Total);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * FallbackBatchSize);
+    }
+
+    // ValueOrElse makes the fallback only on error, but still copies the value out.
+    template <typename T>
+    void LazyValueOrElse(benchmark::State& State) {
+        const auto Results = MakeResults<T>();
+        for (auto _ : State) {
+            std::size_t Total = 0;
+            for (const Expected<T, ErrorCode>& Result : Results) {
+                Total += Fallbacks<T>::Weight(Result.ValueOrElse(Fallbacks<T>::Default));
+            }
+            benchmark::DoNotOptimize(Total);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * FallbackBatchSize);
+    }
+
+    // ValueOrRef reads the value, or a fallback made once by the caller, in place.
+    template <typename T>
+    void BorrowedValueOrRef(benchmark::State& State) {
+        const auto Results = MakeResults<T>();
+        const T Fallback = Fallbacks<T>::Default();
+        for (auto _ : State) {
+            std::size_t Total = 0;
+            for (const Expected<T, ErrorCode>& Result : Results) {
+                Total += Fallbacks<T>::Weight(Result.ValueOrRef(Fallback));
+            }
+            benchmark::DoNotOptimize(Total);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * FallbackBatchSize);
+    }
+
+    BENCHMARK_TEMPLATE(EagerValueOr, std::string);
+    BENCHMARK_TEMPLATE(LazyValueOrElse, std::string);
+    BENCHMARK_TEMPLATE(BorrowedValueOrRef, std::string);
+    BENCHMARK_TEMPLATE(EagerValueOr, std::vector<std::int64_t>);
+    BENCHMARK_TEMPLATE(LazyValueOrElse, std::vector<std::int64_t>);
+    BENCHMARK_TEMPLATE(BorrowedValueOrRef, std::vector<std::int64_t>);
+}
@@ -0,0 +1,72 @@
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::benchmarks {
+    // Same two words as std::int64_t, but the user-provided copy constructor forces a hidden return pointer.
+    struct NonTrivialWord {
+        std::int64_t Value;
+
+        explicit NonTrivialWord(std::int64_t Value) noexcept : Value(Value) {}
+
+        NonTrivialWord(const NonTrivialWord& Other) noexcept : Value(Other.Value) {}
+    };
+
+    struct ThreeWords {
+        std::int64_t Value;
+        std::int64_t Padding[2];
+
+        explicit ThreeWords(std::int64_t Value) noexcept : Value(Value), Padding{} {}
+    };
+
+    template <typename X>
+    std::int64_t WordOf(const X& Value) noexcept {
+        if constexpr (std::is_same_v<X, std::int64_t>) {
+            return Value;
+        } else {
+            return Value.Value;
+        }
+    }
+
+    static_assert(IsRegisterPassable<Expected<std::int64_t, std::int64_t>>());
+    static_assert(!IsRegisterPassable<Expected<NonTrivialWord, std::int64_t>>());
+    static_assert(!IsRegisterPassable<Expected<ThreeWords, std::int64_t>>());
+
+    // Every frame returns its result by value, so the return path is taken once per level.
+    template <typename T>
+    [[gnu::noinline]] Expected<T, std::int64_t> Unwind(std::int64_t Input, int Depth) noexcept {
+        if (Depth == 0) {
+            if (Input % 16 == 0) {
+                return Unexpected(Input);
+            }
+            return T(Input);
+        }
+        Expected<T, std::int64_t> Result = Unwind<T>(Input + 1, Depth - 1);
+        if (!Result.HasValue()) {
+            return Unexpected(Result.Error());
+        }
+        return T(WordOf(*Result) + 1);
+    }
+
+    template <typename T>
+    void ReturnPath(benchmark::State& State) {
+        const auto Depth = int(State.range(0));
+
+        for (auto _ : State) {
+            std::int64_t Sum = 0;
+            for (std::int64_t I = 0; I < 1024; ++I) {
+                auto Result = Unwind<T>(I, Depth);
+                Sum += Result.HasValue() ? WordOf(*Result) : Result.Error();
+            }
+            benchmark::DoNotOptimize(Sum);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * 1024 * (Depth + 1));
+        State.counters["bytes"] = double(sizeof(Expected<T, std::int64_t>));
+    }
+
+    BENCHMARK_TEMPLATE(ReturnPath, std::int64_t)->RangeMultiplier(2)->Range(1, 64);
+    BENCHMARK_TEMPLATE(ReturnPath, NonTrivialWord)->RangeMultiplier(2)->Range(1, 64);
+    BENCHMARK_TEMPLATE(ReturnPath, ThreeWords)->RangeMultiplier(2)->Range(1, 64);
+}
@@ -0,0 +1,52 @@
+#include <cstdint>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/MemoCache.hpp>
+
+namespace stdx::benchmarks {
+    enum class ResolveError : std::int32_t { NotFound };
+
+    using Cache = MemoCache<std::int64_t, std::string, ResolveError>;
+
+    // Stands in for a DNS-like lookup: a few microseconds of work, failing for negative keys.
+    Expected<std::string, ResolveError> Resolve(std::int64_t Key) {
+        std::uint64_t State = std::uint64_t(Key);
+        for (int I = 0; I < 2000; ++I) {
+            State = State * 6364136223846793005ull + 1442695040888963407ull;
+        }
+        benchmark::DoNotOptimize(State);
+        if (Key < 0) {
+            return Unexpected(ResolveError::NotFound);
+        }
+        return "host-" + std::to_string(Key) + ".example.internal";
+    }
+
+    Cache* Shared = nullptr;
+
+    // Arguments: the number of shards, and the share of lookups (per mille) for keys that fail and are never repeated,
+    // a storm against the 1024 hot keys that every thread keeps asking for.
+    void Lookup(benchmark::State& State) {
+        if (State.thread_index() == 0) {
+            Shared = new Cache(2048, 256, std::size_t(State.range(0)));
+        }
+        const std::int64_t StormPerMille = State.range(1);
+        std::int64_t Storm = -std::int64_t(State.thread_index()) * (std::int64_t(1) << 40) - 1;
+
+        std::uint64_t Random = std::uint64_t(State.thread_index()) + 1;
+        for (auto _ : State) {
+            Random = Random * 6364136223846793005ull + 1442695040888963407ull;
+            const std::int64_t Pick = std::int64_t(Random >> 33);
+            const std::int64_t Key = Pick % 1000 < StormPerMille ? Storm-- : Pick % 1024;
+            benchmark::DoNotOptimize(Shared->GetOrCompute(Key, Resolve));
+        }
+        State.SetItemsProcessed(State.iterations());
+
+        if (State.thread_index() == 0) {
+            delete Shared;
+        }
+    }
+
+    BENCHMARK(Lookup)->Args({1, 0})->Args({16, 0})->Args({16, 100})->ThreadRange(1, 8)->UseRealTime();
+}
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::benchmarks {
+    enum class ErrorCode : std::int32_t { None, Timeout, Refused };
+
+    // Long enough to defeat the small string optimization, so the non-trivial cases really allocate.
+    inline const std::string LongValue(48, 'v');
+    inline const std::string LongError(48, 'e');
+
+    template <typename T>
+    struct Samples;
+
+    template <>
+    struct Samples<int> {
+        static int Value(int I) noexcept {
+            return I;
+        }
+
+        static int Step(int V) noexcept {
+            return V + 1;
+        }
+    };
+
+    template <>
+    struct Samples<ErrorCode> {
+        static ErrorCode Error() noexcept {
+            return ErrorCode::Timeout;
+        }
+    };
+
+    template <>
+    struct Samples<std::string> {
+        static std::string Value(int) {
+            return LongValue;
+        }
+
+        static std::string Step(std::string V) noexcept {
+            return V;
+        }
+
+        static std::string Error() {
+            return LongError;
+        }
+    };
+
+    // Every model exposes the same static interface so that a single benchmark template can be instantiated for
+    // Expected and for the alternatives it competes with on hot paths.
+    template <typename T, typename E>
+    struct ExpectedModel {
+        using ValueType = T;
+        using ErrorType = E;
+        using Type = Expected<T, E>;
+
+        static Type MakeValue(T Value) {
+            return Type(std::in_place, std::move(Value));
+        }
+
+        static Type MakeError(E Error) {
+            return Type(unexpect, std::move(Error));
+        }
+
+        static Type Propagate(Type&& Failed) {
+            return Type(unexpect, std::move(Failed).Error());
+        }
+
+        static bool HasValue(const Type& X) noexcept {
+            return X.HasValue();
+        }
+
+        static T& Value(Type& X) noexcept {
+            return *X;
+        }
+
+        static T ValueOr(const Type& X, const T& Default) {
+            return X.ValueOr(Default);
+        }
+
+        static void Emplace(Type& X, T Value) {
+            X.Emplace(std::move(Value));
+        }
+
+        static void Swap(Type& X, Type& Y) {
+            X.Swap(Y);
+        }
+    };
+
+    // std::optional drops the error altogether, which makes it the lower bound of what carrying one costs.
+    template <typename T, typename E>
+    struct OptionalModel {
+        using ValueType = T;
+        using ErrorType = E;
+        using Type = std::optional<T>;
+
+        static Type MakeValue(T Value) {
+            return Type(std::in_place, std::move(Value));
+        }
+
+        static Type MakeError(E) {
+            return std::nullopt;
+        }
+
+        static Type Propagate(Type&&) {
+            return std::nullopt;
+        }
+
+        static bool HasValue(const Type& X) noexcept {
+            return X.has_value();
+        }
+
+        static T& Value(Type& X) noexcept {
+            return *X;
+        }
+
+        static T ValueOr(const Type& X, const T& Default) {
+            return X.value_or(Default);
+        }
+
+        static void Emplace(Type& X, T Value) {
+            X.emplace(std::move(Value));
+        }
+
+        static void Swap(Type& X, Type& Y) {
+            X.swap(Y);
+        }
+    };
+
+    template <typename T, typename E>
+    struct VariantModel {
+        using ValueType = T;
+        using ErrorType = E;
+        using Type = std::variant<T, E>;
+
+        static Type MakeValue(T Value) {
+            return Type(std::in_place_index<0>, std::move(Value));
+        }
+
+        static Type MakeError(E Error) {
+            return Type(std::in_place_index<1>, std::move(Error));
+        }
+
+        static Type Propagate(Type&& Failed) {
+            return Type(std::in_place_index<1>, std::get<1>(std::move(Failed)));
+        }
+
+        static bool HasValue(const Type& X) noexcept {
+            return X.index() == 0;
+        }
+
+        static T& Value(Type& X) noexcept {
+            return *std::get_if<0>(&X);
+        }
+
+        static T ValueOr(const Type& X, const T& Default) {
+            const T* Value = std::get_if<0>(&X);
+            return Value ? *Value : Default;
+        }
+
+        static void Emplace(Type& X, T Value) {
+            X.template emplace<0>(std::move(Value));
+        }
+
+        static void Swap(Type& X, Type& Y) {
+            X.swap(Y);
+        }
+    };
+
+    // Both fields are always live, as in a hand-written C-style result struct.
+    template <typename T, typename E>
+    struct RawModel {
+        using ValueType = T;
+        using ErrorType = E;
+
+        struct Type {
+            T Value;
+            E Error;
+            bool bHasValue;
+        };
+
+        static Type MakeValue(T Value) {
+            return Type{std::move(Value), E(), true};
+        }
+
+        static Type MakeError(E Error) {
+            return Type{T(), std::move(Error), false};
+        }
+
+        static Type Propagate(Type&& Failed) {
+            return Type{T(), std::move(Failed.Error), false};
+        }
+
+        static bool HasValue(const Type& X) noexcept {
+            return X.bHasValue;
+        }
+
+        static T& Value(Type& X) noexcept {
+            return X.Value;
+        }
+
+        static T ValueOr(const Type& X, const T& Default) {
+            return X.bHasValue ? X.Value : Default;
+        }
+
+        static void Emplace(Type& X, T Value) {
+            X.Value = std::move(Value);
+            X.bHasValue = true;
+        }
+
+        static void Swap(Type& X, Type& Y) {
+            using std::swap;
+            swap(X, Y);
+        }
+    };
+
+    // One element in every 16 holds an error.
+    template <typename Model>
+    typename Model::Type MakeSample(int I) {
+        if (I % 16 == 0) {
+            return Model::MakeError(Samples<typename Model::ErrorType>::Error());
+        }
+        return Model::MakeValue(Samples<typename Model::ValueType>::Value(I));
+    }
+
+// Registers Func for every model, once over trivial and once over non-trivial T/E; Options are appended to each.
+#define _BENCHMARK_MODELS(Func, Options)                                                                                         \
+    BENCHMARK_TEMPLATE(Func, ExpectedModel<int, ErrorCode>) Options;                                                             \
+    BENCHMARK_TEMPLATE(Func, OptionalModel<int, ErrorCode>) Options;                                                             \
+    BENCHMARK_TEMPLATE(Func, VariantModel<int, ErrorCode>) Options;                                                              \
+    BENCHMARK_TEMPLATE(Func, RawModel<int, ErrorCode>) Options;                                                                  \
+    BENCHMARK_TEMPLATE(Func, ExpectedModel<std::string, std::string>) Options;                                                   \
+    BENCHMARK_TEMPLATE(Func, OptionalModel<std::string, std::string>) Options;                                                   \
+    BENCHMARK_TEMPLATE(Func, VariantModel<std::string, std::string>) Options;                                                    \
+    BENCHMARK_TEMPLATE(Func, RawModel<std::string, std::string>) Options
+}
@@ -0,0 +1,70 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::benchmarks {
+    enum class LookupError : std::uint8_t { Missing, Expired };
+
+    // Identical payloads; only PackedId declares that its top byte is never 0xFF.
+    struct PlainId {
+        std::uint8_t Bytes[3];
+        std::uint8_t Shard;
+    };
+
+    struct PackedId {
+        std::uint8_t Bytes[3];
+        std::uint8_t Shard;
+    };
+}
+
+template <>
+struct stdx::NicheTraits<stdx::benchmarks::PackedId> {
+    static constexpr std::size_t Offset = offsetof(stdx::benchmarks::PackedId, Shard);
+    static constexpr unsigned char Value = 0xFF;
+};
+
+namespace stdx::benchmarks {
+    static_assert(sizeof(Expected<PackedId, LookupError>) == 4);
+    static_assert(sizeof(Expected<PlainId, LookupError>) == 5);
+
+    template <typename Id>
+    void RandomGather(benchmark::State& State) {
+        using Result = Expected<Id, LookupError>;
+
+        const auto Count = std::size_t(State.range(0));
+        std::vector<Result> Results;
+        Results.reserve(Count);
+        for (std::size_t I = 0; I < Count; ++I) {
+            if (I % 8 != 0) {
+                Results.emplace_back(Id{{std::uint8_t(I), 0, 0}, std::uint8_t(I % 64)});
+            } else {
+                Results.emplace_back(unexpect, LookupError::Missing);
+            }
+        }
+
+        std::vector<std::uint32_t> Indices(1 << 16);
+        std::mt19937 Engine(42);
+        std::uniform_int_distribution<std::uint32_t> Distribution(0, std::uint32_t(Count - 1));
+        for (auto& Index : Indices) {
+            Index = Distribution(Engine);
+        }
+
+        for (auto _ : State) {
+            std::uint64_t Sum = 0;
+            for (auto Index : Indices) {
+                const Result& R = Results[Index];
+                Sum += R.HasValue() ? R->Shard : 1;
+            }
+            benchmark::DoNotOptimize(Sum);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * std::int64_t(Indices.size()));
+        State.counters["bytes"] = double(Count * sizeof(Result));
+    }
+
+    BENCHMARK_TEMPLATE(RandomGather, PlainId)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+    BENCHMARK_TEMPLATE(RandomGather, PackedId)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+}
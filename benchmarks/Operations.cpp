@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Models.hpp"
+
+namespace stdx::benchmarks {
+    constexpr int BatchSize = 1024;
+
+    template <typename Model>
+    std::vector<typename Model::Type> MakeBatch() {
+        std::vector<typename Model::Type> Batch;
+        Batch.reserve(BatchSize);
+        for (int I = 0; I < BatchSize; ++I) {
+            Batch.push_back(MakeSample<Model>(I));
+        }
+        return Batch;
+    }
+
+    template <typename Model>
+    void Construct(benchmark::State& State) {
+        for (auto _ : State) {
+            for (int I = 0; I < BatchSize; ++I) {
+                auto X = MakeSample<Model>(I);
+                benchmark::DoNotOptimize(X);
+            }
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * BatchSize);
+    }
+
+    template <typename Model>
+    void CopyConstruct(benchmark::State& State) {
+        const auto Batch = MakeBatch<Model>();
+
+        for (auto _ : State) {
+            for (const auto& Source : Batch) {
+                auto X = Source;
+                benchmark::DoNotOptimize(X);
+            }
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * BatchSize);
+    }
+
+    // Moves every element out and back in, so the batch stays intact between iterations.
+    template <typename Model>
+    void MoveRoundTrip(benchmark::State& State) {
+        auto Batch = MakeBatch<Model>();
+
+        for (auto _ : State) {
+            for (auto& Source : Batch) {
+                auto X = std::move(Source);
+                benchmark::DoNotOptimize(X);
+                Source = std::move(X);
+            }
+            benchmark::ClobberMemory();
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * BatchSize);
+    }
+
+    template <typename Model>
+    void Swap(benchmark::State& State) {
+        auto Batch = MakeBatch<Model>();
+
+        for (auto _ : State) {
+            for (int I = 0; I + 1 < BatchSize; ++I) {
+                Model::Swap(Batch[I], Batch[I + 1]);
+            }
+            benchmark::ClobberMemory();
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * (BatchSize - 1));
+    }
+
+    // Every element in the batch starts out holding an error, so each Emplace switches the active alternative.
+    template <typename Model>
+    void Emplace(benchmark::State& State) {
+        using T = typename Model::ValueType;
+        using E = typename Model::ErrorType;
+
+        const auto Error = Model::MakeError(Samples<E>::Error());
+        std::vector<typename Model::Type> Batch(BatchSize, Error);
+
+        for (auto _ : State) {
+            State.PauseTiming();
+            std::fill(Batch.begin(), Batch.end(), Error);
+            State.ResumeTiming();
+            for (int I = 0; I < BatchSize; ++I) {
+                Model::Emplace(Batch[I], Samples<T>::Value(I));
+            }
+            benchmark::ClobberMemory();
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * BatchSize);
+    }
+
+    template <typename Model>
+    void ValueOr(benchmark::State& State) {
+        using T = typename Model::ValueType;
+
+        const auto Batch = MakeBatch<Model>();
+        const T Default = Samples<T>::Value(-1);
+
+        for (auto _ : State) {
+            for (const auto& X : Batch) {
+                auto Value = Model::ValueOr(X, Default);
+                benchmark::DoNotOptimize(Value);
+            }
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * BatchSize);
+    }
+
+    _BENCHMARK_MODELS(Construct, );
+    _BENCHMARK_MODELS(CopyConstruct, );
+    _BENCHMARK_MODELS(MoveRoundTrip, );
+    _BENCHMARK_MODELS(Swap, );
+    _BENCHMARK_MODELS(Emplace, );
+    _BENCHMARK_MODELS(ValueOr, );
+}
@@ -0,0 +1,74 @@
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#include "Models.hpp"
+
+namespace stdx::benchmarks {
+    // Each level checks the result of the one below, forwards its error and otherwise transforms the value, which is
+    // what a service handler does between parsing a request and touching storage.
+    template <typename Model>
+    [[gnu::noinline]] typename Model::Type Descend(int Input, int Depth) {
+        if (Depth == 0) {
+            return MakeSample<Model>(Input);
+        }
+        auto Result = Descend<Model>(Input, Depth - 1);
+        if (!Model::HasValue(Result)) {
+            return Model::Propagate(std::move(Result));
+        }
+        return Model::MakeValue(Samples<typename Model::ValueType>::Step(std::move(Model::Value(Result))));
+    }
+
+    // The classic C-style alternative: the error code is the return value and the payload goes through an out parameter.
+    template <typename T, typename E>
+    [[gnu::noinline]] E DescendRawCode(int Input, int Depth, T& Out) {
+        if (Depth == 0) {
+            if (Input % 16 == 0) {
+                return Samples<E>::Error();
+            }
+            Out = Samples<T>::Value(Input);
+            return E();
+        }
+        T Inner{};
+        E Code = DescendRawCode<T, E>(Input, Depth - 1, Inner);
+        if (Code != E()) {
+            return Code;
+        }
+        Out = Samples<T>::Step(std::move(Inner));
+        return E();
+    }
+
+    template <typename Model>
+    void Propagate(benchmark::State& State) {
+        const auto Depth = int(State.range(0));
+
+        for (auto _ : State) {
+            for (int I = 0; I < 1024; ++I) {
+                auto Result = Descend<Model>(I, Depth);
+                benchmark::DoNotOptimize(Result);
+            }
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * 1024);
+    }
+
+    template <typename T, typename E>
+    void PropagateRawCode(benchmark::State& State) {
+        const auto Depth = int(State.range(0));
+
+        for (auto _ : State) {
+            for (int I = 0; I < 1024; ++I) {
+                T Value{};
+                E Code = DescendRawCode<T, E>(I, Depth, Value);
+                benchmark::DoNotOptimize(Code);
+                benchmark::DoNotOptimize(Value);
+            }
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * 1024);
+    }
+
+    _BENCHMARK_MODELS(Propagate, ->DenseRange(1, 10));
+    BENCHMARK_TEMPLATE(PropagateRawCode, int, ErrorCode)->DenseRange(1, 10);
+    BENCHMARK_TEMPLATE(PropagateRawCode, std::string, std::string)->DenseRange(1, 10);
+}
@@ -0,0 +1,97 @@
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::benchmarks {
+    enum class LookupError : std::int32_t { Missing };
+
+    // Big enough that copying one out of the table dominates the lookup itself.
+    struct Record {
+        std::string Name;
+        std::array<std::int64_t, 32> Counters;
+    };
+
+    using Table = std::unordered_map<std::int64_t, Record>;
+
+    Table MakeTable(std::int64_t Count) {
+        Table Records;
+        for (std::int64_t I = 0; I < Count; ++I) {
+            Record R{"record with a name too long for small string optimization " + std::to_string(I), {}};
+            R.Counters.fill(I);
+            Records.emplace(I, std::move(R));
+        }
+        return Records;
+    }
+
+    struct ByCopy {
+        using Result = Expected<Record, LookupError>;
+
+        static Result Wrap(const Record& R) {
+            return R;
+        }
+
+        static std::int64_t Use(const Result& X) noexcept {
+            return X->Counters[0];
+        }
+    };
+
+    struct ByPointer {
+        using Result = Expected<const Record*, LookupError>;
+
+        static Result Wrap(const Record& R) noexcept {
+            return &R;
+        }
+
+        static std::int64_t Use(const Result& X) noexcept {
+            return (*X)->Counters[0];
+        }
+    };
+
+    struct ByReference {
+        using Result = Expected<const Record&, LookupError>;
+
+        static Result Wrap(const Record& R) noexcept {
+            return R;
+        }
+
+        static std::int64_t Use(const Result& X) noexcept {
+            return X->Counters[0];
+        }
+    };
+
+    template <typename Model>
+    [[gnu::noinline]] typename Model::Result Find(const Table& Records, std::int64_t Key) {
+        const auto It = Records.find(Key);
+        if (It == Records.end()) {
+            return Unexpected(LookupError::Missing);
+        }
+        return Model::Wrap(It->second);
+    }
+
+    // Argument: the share of lookups that miss.
+    template <typename Model>
+    void Lookup(benchmark::State& State) {
+        const Table Records = MakeTable(1024);
+        const std::int64_t MissPercent = State.range(0);
+
+        for (auto _ : State) {
+            std::int64_t Sum = 0;
+            for (std::int64_t I = 0; I < 1000; ++I) {
+                const std::int64_t Key = I % 100 < MissPercent ? -I : I;
+                const auto Result = Find<Model>(Records, Key);
+                Sum += Result.HasValue() ? Model::Use(Result) : 1;
+            }
+            benchmark::DoNotOptimize(Sum);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * 1000);
+    }
+
+    BENCHMARK_TEMPLATE(Lookup, ByCopy)->Arg(0)->Arg(50);
+    BENCHMARK_TEMPLATE(Lookup, ByPointer)->Arg(0)->Arg(50);
+    BENCHMARK_TEMPLATE(Lookup, ByReference)->Arg(0)->Arg(50);
+}
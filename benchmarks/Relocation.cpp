@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/Expected.hpp>
+
+#include "Models.hpp"
+
+namespace stdx::benchmarks {
+    // A sort key with a heap-allocated body, the same whether or not it opts in to trivial relocation.
+    template <bool bRelocatable>
+    struct Record {
+        std::int64_t Key;
+        std::unique_ptr<std::int64_t> Body;
+    };
+}
+
+template <>
+struct stdx::IsTriviallyRelocatable<stdx::benchmarks::Record<true>> : std::true_type {};
+
+namespace stdx::benchmarks {
+    template <bool bRelocatable>
+    using Entry = Expected<Record<bRelocatable>, ErrorCode>;
+
+    template <bool bRelocatable>
+    Entry<bRelocatable> MakeEntry(std::uint64_t& Random) {
+        Random = Random * 6364136223846793005ull + 1442695040888963407ull;
+        const std::int64_t Key = std::int64_t(Random >> 33);
+        if (Key % 16 == 0) {
+            return Unexpected(ErrorCode::Refused);
+        }
+        return Record<bRelocatable>{Key, std::make_unique<std::int64_t>(Key)};
+    }
+
+    // Errors first, then values by key.
+    template <bool bRelocatable>
+    bool Precedes(const Entry<bRelocatable>& X, const Entry<bRelocatable>& Y) noexcept {
+        if (X.HasValue() != Y.HasValue()) {
+            return !X.HasValue();
+        }
+        return X.HasValue() && X->Key < Y->Key;
+    }
+
+    // std::sort exchanges elements with swap while partitioning, which is a byte swap for the relocatable entries.
+    template <bool bRelocatable>
+    void Sort(benchmark::State& State) {
+        const std::size_t Count = std::size_t(State.range(0));
+        std::uint64_t Random = 1;
+        for (auto _ : State) {
+            State.PauseTiming();
+            std::vector<Entry<bRelocatable>> Entries;
+            Entries.reserve(Count);
+            for (std::size_t I = 0; I < Count; ++I) {
+                Entries.push_back(MakeEntry<bRelocatable>(Random));
+            }
+            State.ResumeTiming();
+
+            std::sort(Entries.begin(), Entries.end(), Precedes<bRelocatable>);
+            benchmark::DoNotOptimize(Entries.data());
+
+            State.PauseTiming();
+            Entries.clear();
+            State.ResumeTiming();
+        }
+        State.SetItemsProcessed(State.iterations() * State.range(0));
+    }
+
+    // The growth policy of a vector, relocating through UninitializedRelocate: one memcpy for relocatable entries, a
+    // move and a destructor call per element for the others. It has the interface of std::vector it is compared with.
+    template <typename X>
+    class GrowableBuffer {
+    public:
+        GrowableBuffer() = default;
+        GrowableBuffer(const GrowableBuffer&) = delete;
+        GrowableBuffer& operator=(const GrowableBuffer&) = delete;
+
+        ~GrowableBuffer() {
+            std::destroy(Begin, End);
+            ::operator delete(static_cast<void*>(Begin));
+        }
+
+        void push_back(X&& Value) {
+            if (End == Capacity) {
+                const std::size_t Size = std::size_t(End - Begin);
+                const std::size_t NewCapacity = Size == 0 ? 16 : 2 * Size;
+                X* const NewBegin = static_cast<X*>(::operator new(NewCapacity * sizeof(X)));
+                End = UninitializedRelocate(Begin, End, NewBegin);
+                ::operator delete(static_cast<void*>(Begin));
+                Begin = NewBegin;
+                Capacity = NewBegin + NewCapacity;
+            }
+            ::new (static_cast<void*>(End)) X(std::move(Value));
+            ++End;
+        }
+
+        X* data() noexcept {
+            return Begin;
+        }
+
+    private:
+        X* Begin = nullptr;
+        X* End = nullptr;
+        X* Capacity = nullptr;
+    };
+
+    // Appends to a buffer that grows from empty. Entries are created ahead, so only the appends and the reallocations
+    // are measured.
+    template <typename Container, bool bRelocatable>
+    void Grow(benchmark::State& State) {
+        const std::size_t Count = std::size_t(State.range(0));
+        std::uint64_t Random = 1;
+        std::vector<Entry<bRelocatable>> Source;
+        Source.reserve(Count);
+        for (std::size_t I = 0; I < Count; ++I) {
+            Source.push_back(MakeEntry<bRelocatable>(Random));
+        }
+
+        for (auto _ : State) {
+            Container Entries;
+            for (Entry<bRelocatable>& X : Source) {
+                Entries.push_back(std::move(X));
+            }
+            benchmark::DoNotOptimize(Entries.data());
+
+            // Hands the entries back, so that every iteration moves the same heap blocks.
+            State.PauseTiming();
+            for (std::size_t I = 0; I < Count; ++I) {
+                Source[I] = std::move(Entries.data()[I]);
+            }
+            State.ResumeTiming();
+        }
+        State.SetItemsProcessed(State.iterations() * State.range(0));
+    }
+
+    BENCHMARK_TEMPLATE(Sort, true)->Arg(1 << 16);
+    BENCHMARK_TEMPLATE(Sort, false)->Arg(1 << 16);
+
+    BENCHMARK_TEMPLATE(Grow, GrowableBuffer<Entry<true>>, true)->Arg(1 << 16);
+    BENCHMARK_TEMPLATE(Grow, GrowableBuffer<Entry<false>>, false)->Arg(1 << 16);
+    BENCHMARK_TEMPLATE(Grow, std::vector<Entry<true>>, true)->Arg(1 << 16);
+}
@@ -0,0 +1,78 @@
+#include <cstdint>
+#include <string>
+#include <system_error>
+
+#include <benchmark/benchmark.h>
+
+#include <Expected/Expected.hpp>
+#include <Expected/StatusCode.hpp>
+
+namespace stdx::benchmarks {
+    // The std::string baseline formats its message eagerly, as most Expected<T, std::string> code does.
+    struct StringErrors {
+        using Result = Expected<std::int64_t, std::string>;
+
+        static Result Fail(std::int64_t Input) {
+            return Unexpected("request " + std::to_string(Input) + " timed out while waiting for the shard");
+        }
+
+        static std::size_t Report(const std::string& Error) {
+            return Error.size();
+        }
+    };
+
+    struct StatusErrors {
+        using Result = Expected<std::int64_t, StatusCode>;
+
+        static Result Fail(std::int64_t) {
+            return Unexpected(StatusCode(std::errc::timed_out));
+        }
+
+        static std::size_t Report(const StatusCode& Error) {
+            return Error.Message().size();
+        }
+    };
+
+    template <typename Errors>
+    [[gnu::noinline]] typename Errors::Result Fetch(std::int64_t Input, std::int64_t ErrorPercent) {
+        if (Input % 100 < ErrorPercent) {
+            return Errors::Fail(Input);
+        }
+        return Input * 2;
+    }
+
+    template <typename Errors>
+    [[gnu::noinline]] typename Errors::Result Handle(std::int64_t Input, std::int64_t ErrorPercent) {
+        typename Errors::Result Result = Fetch<Errors>(Input, ErrorPercent);
+        if (!Result.HasValue()) {
+            return Unexpected(std::move(Result).Error());
+        }
+        return *Result + 1;
+    }
+
+    // Arguments: the share of failing requests, and how many of the failures (per mille) end up being logged.
+    template <typename Errors>
+    void ErrorHeavy(benchmark::State& State) {
+        const std::int64_t ErrorPercent = State.range(0);
+        const std::int64_t LoggedPerMille = State.range(1);
+
+        for (auto _ : State) {
+            std::size_t Sum = 0;
+            for (std::int64_t I = 0; I < 1000; ++I) {
+                auto Result = Handle<Errors>(I, ErrorPercent);
+                if (Result.HasValue()) {
+                    Sum += std::size_t(*Result);
+                } else if (I % 1000 < LoggedPerMille) {
+                    Sum += Errors::Report(Result.Error());
+                } else {
+                    Sum += 1;
+                }
+            }
+            benchmark::DoNotOptimize(Sum);
+        }
+        State.SetItemsProcessed(std::int64_t(State.iterations()) * 1000);
+    }
+
+    BENCHMARK_TEMPLATE(ErrorHeavy, StringErrors)->Args({0, 0})->Args({10, 10})->Args({50, 10})->Args({100, 10});
+    BENCHMARK_TEMPLATE(ErrorHeavy, StatusErrors)->Args({0, 0})->Args({10, 10})->Args({50, 10})->Args({100, 10});
+}
@@ -13,6 +13,9 @@ int main() {
         static_assert(std::is_trivially_move_constructible_v<T>);
         static_assert(std::is_nothrow_copy_assignable_v<T>);
         static_assert(std::is_nothrow_move_assignable_v<T>);
+        static_assert(std::is_trivially_copy_assignable_v<T>);
+        static_assert(std::is_trivially_move_assignable_v<T>);
+        static_assert(std::is_trivially_copyable_v<T>);
     }
 
     {
@@ -23,6 +26,9 @@ int main() {
         static_assert(std::is_trivially_move_constructible_v<T>);
         static_assert(std::is_nothrow_copy_assignable_v<T>);
         static_assert(std::is_nothrow_move_assignable_v<T>);
+        static_assert(std::is_trivially_copy_assignable_v<T>);
+        static_assert(std::is_trivially_move_assignable_v<T>);
+        static_assert(std::is_trivially_copyable_v<T>);
     }
 
     {
@@ -35,6 +41,9 @@ int main() {
         static_assert(std::is_nothrow_move_constructible_v<T>);
         static_assert(std::is_copy_assignable_v<T>);
         static_assert(std::is_nothrow_move_assignable_v<T>);
+        static_assert(!std::is_trivially_copy_assignable_v<T>);
+        static_assert(!std::is_trivially_move_assignable_v<T>);
+        static_assert(!std::is_trivially_copyable_v<T>);
     }
 
     {
@@ -47,6 +56,16 @@ int main() {
         static_assert(std::is_nothrow_move_constructible_v<T>);
         static_assert(!std::is_copy_assignable_v<T>);
         static_assert(std::is_nothrow_move_assignable_v<T>);
+        static_assert(!std::is_trivially_move_assignable_v<T>);
+    }
+
+    {
+        enum class ErrCode : int { Timeout, Refused };
+
+        using T = stdx::Expected<int, ErrCode>;
+        static_assert(std::is_trivially_copyable_v<T>);
+        static_assert(std::is_trivially_copy_assignable_v<T>);
+        static_assert(std::is_trivially_move_assignable_v<T>);
     }
 
     {
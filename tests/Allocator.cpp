@@ -0,0 +1,123 @@
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::tests {
+    using String = std::pmr::string;
+    using PmrExpected = Expected<String, String>;
+
+    // Strings longer than the small buffer, so that they do allocate.
+    const char* const Long = "a string that does not fit in the small buffer";
+    const char* const Failure = "an error that does not fit in the small buffer either";
+
+    std::pmr::memory_resource* ResourceOf(const String& Str) noexcept {
+        return Str.get_allocator().resource();
+    }
+
+    static_assert(std::uses_allocator_v<PmrExpected, std::pmr::polymorphic_allocator<char>>);
+    static_assert(std::uses_allocator_v<Expected<void, String>, std::pmr::polymorphic_allocator<char>>);
+    static_assert(!std::uses_allocator_v<Expected<int, int>, std::pmr::polymorphic_allocator<char>>);
+    static_assert(!std::uses_allocator_v<Expected<String&, int>, std::pmr::polymorphic_allocator<char>>);
+
+    TEST(Allocator, ConstructsWithAllocator) {
+        std::pmr::monotonic_buffer_resource Arena;
+        const std::pmr::polymorphic_allocator<char> Alloc(&Arena);
+
+        const PmrExpected Empty(std::allocator_arg, Alloc);
+        ASSERT_TRUE(Empty.HasValue());
+        ASSERT_EQ(ResourceOf(*Empty), &Arena);
+
+        const PmrExpected Value(std::allocator_arg, Alloc, Long);
+        ASSERT_EQ(*Value, Long);
+        ASSERT_EQ(ResourceOf(*Value), &Arena);
+
+        const PmrExpected InPlace(std::allocator_arg, Alloc, std::in_place, std::size_t(3), 'x');
+        ASSERT_EQ(*InPlace, "xxx");
+        ASSERT_EQ(ResourceOf(*InPlace), &Arena);
+
+        const PmrExpected Error(std::allocator_arg, Alloc, unexpect, Failure);
+        ASSERT_EQ(Error.Error(), Failure);
+        ASSERT_EQ(ResourceOf(Error.Error()), &Arena);
+
+        const PmrExpected FromUnexpected(std::allocator_arg, Alloc, Unexpected<std::string>(Failure));
+        ASSERT_EQ(ResourceOf(FromUnexpected.Error()), &Arena);
+
+        const PmrExpected Copy(std::allocator_arg, Alloc, PmrExpected(Long));
+        ASSERT_EQ(*Copy, Long);
+        ASSERT_EQ(ResourceOf(*Copy), &Arena);
+
+        const PmrExpected CopiedError(std::allocator_arg, Alloc, Error);
+        ASSERT_EQ(CopiedError.Error(), Failure);
+        ASSERT_EQ(ResourceOf(CopiedError.Error()), &Arena);
+
+        const Expected<void, String> Void(std::allocator_arg, Alloc, unexpect, Failure);
+        ASSERT_EQ(ResourceOf(Void.Error()), &Arena);
+    }
+
+    TEST(Allocator, AssignmentKeepsResource) {
+        std::pmr::monotonic_buffer_resource Arena;
+        const std::pmr::polymorphic_allocator<char> Alloc(&Arena);
+
+        PmrExpected Ex(std::allocator_arg, Alloc, unexpect, Failure);
+        const PmrExpected Value(Long);
+        ASSERT_EQ(ResourceOf(*Value), std::pmr::get_default_resource());
+
+        Ex = Value;
+        ASSERT_EQ(*Ex, Long);
+        ASSERT_EQ(ResourceOf(*Ex), &Arena);
+
+        Ex = Unexpected<String>(Failure);
+        ASSERT_EQ(Ex.Error(), Failure);
+        ASSERT_EQ(ResourceOf(Ex.Error()), &Arena);
+
+        Ex = std::string(Long);
+        ASSERT_EQ(ResourceOf(*Ex), &Arena);
+
+        Ex = PmrExpected(unexpect, Failure);
+        ASSERT_EQ(ResourceOf(Ex.Error()), &Arena);
+
+        // A value assigned over a value is assigned, which keeps the resource of the one assigned to.
+        Ex = Value;
+        Ex = Value;
+        ASSERT_EQ(ResourceOf(*Ex), &Arena);
+    }
+
+    TEST(Allocator, EmplaceKeepsResource) {
+        std::pmr::monotonic_buffer_resource Arena;
+        const std::pmr::polymorphic_allocator<char> Alloc(&Arena);
+
+        PmrExpected Ex(std::allocator_arg, Alloc, Long);
+        ASSERT_EQ(Ex.Emplace(std::size_t(64), 'y'), String(64, 'y'));
+        ASSERT_EQ(ResourceOf(*Ex), &Arena);
+
+        Ex = Unexpected<String>(Failure);
+        Ex.Emplace(Long);
+        ASSERT_EQ(ResourceOf(*Ex), &Arena);
+
+        PmrExpected Default;
+        Default.Emplace(std::allocator_arg, Alloc, Long);
+        ASSERT_EQ(*Default, Long);
+        ASSERT_EQ(ResourceOf(*Default), &Arena);
+    }
+
+    TEST(Allocator, ContainerPassesItsResource) {
+        std::pmr::monotonic_buffer_resource Arena;
+        std::pmr::vector<PmrExpected> Results(&Arena);
+        Results.emplace_back(Long);
+        Results.emplace_back(unexpect, Failure);
+        Results.emplace_back();
+        Results.push_back(PmrExpected(Long));
+
+        ASSERT_EQ(ResourceOf(*Results[0]), &Arena);
+        ASSERT_EQ(ResourceOf(Results[1].Error()), &Arena);
+        ASSERT_EQ(ResourceOf(*Results[2]), &Arena);
+        ASSERT_EQ(ResourceOf(*Results[3]), &Arena);
+        ASSERT_EQ(Results[1].Error(), Failure);
+    }
+}
@@ -0,0 +1,90 @@
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include <Expected/ExpectedBatch.hpp>
+
+namespace stdx::tests {
+    enum class BatchError { Overflow, Underflow };
+
+    static_assert(std::is_same_v<decltype(*std::declval<const ExpectedBatch<int, BatchError>&>()[0]), const int&>);
+    static_assert(std::is_convertible_v<ExpectedBatch<int, BatchError>::Reference, Expected<int, BatchError>>);
+
+    TEST(ExpectedBatch, Append) {
+        ExpectedBatch<double, BatchError> Batch;
+        ASSERT_TRUE(Batch.Empty());
+
+        Batch.PushBack(Expected<double, BatchError>(1.5));
+        Batch.PushBack(Unexpected(BatchError::Overflow));
+        ASSERT_EQ(Batch.EmplaceValue(2.5), 2.5);
+        ASSERT_EQ(Batch.EmplaceError(BatchError::Underflow), BatchError::Underflow);
+
+        ASSERT_EQ(Batch.Size(), 4);
+        ASSERT_EQ(Batch.CountValues(), 2);
+        ASSERT_EQ(Batch.CountErrors(), 2);
+        ASSERT_TRUE(Batch.HasValue(0));
+        ASSERT_FALSE(Batch.HasValue(1));
+        ASSERT_EQ(Batch.BitmapWord(0), 0b0101);
+
+        ASSERT_EQ(*Batch[0], 1.5);
+        ASSERT_EQ(Batch[1].Error(), BatchError::Overflow);
+        ASSERT_EQ(Batch[2].Value(), 2.5);
+        ASSERT_EQ(Batch[3].ValueOr(0.0), 0.0);
+
+        Expected<double, BatchError> Ex = Batch[3];
+        ASSERT_EQ(Ex, Unexpected(BatchError::Underflow));
+        Ex = Batch[2];
+        ASSERT_EQ(Ex, 2.5);
+
+        Batch.Clear();
+        ASSERT_TRUE(Batch.Empty());
+        ASSERT_EQ(Batch.CountValues(), 0);
+    }
+
+    TEST(ExpectedBatch, Columns) {
+        ExpectedBatch<std::string, std::string> Batch;
+        for (int I = 0; I < 200; ++I) {
+            if (I % 3 == 0) {
+                Batch.EmplaceError("e" + std::to_string(I));
+            } else {
+                Batch.EmplaceValue("v" + std::to_string(I));
+            }
+        }
+        ASSERT_EQ(Batch.CountErrors(), 67);
+        ASSERT_EQ(Batch.CountValues(), 133);
+
+        // Values() skips the errors and preserves order.
+        std::size_t N = 0;
+        for (const std::string& Value : std::as_const(Batch).Values()) {
+            int I = int(N / 2 * 3 + N % 2 + 1);
+            ASSERT_EQ(Value, "v" + std::to_string(I));
+            ++N;
+        }
+        ASSERT_EQ(N, Batch.CountValues());
+        ASSERT_EQ(Batch.Errors()[66], "e198");
+
+        for (std::size_t I = 0; I <= Batch.Size(); ++I) {
+            ASSERT_EQ(Batch.CountValues(I), I - (I + 2) / 3);
+        }
+        for (std::size_t I = 0; I < Batch.Size(); ++I) {
+            const auto Element = std::as_const(Batch)[I];
+            ASSERT_EQ(Element.HasValue(), I % 3 != 0);
+            ASSERT_EQ(Element ? *Element : Element.Error(), (I % 3 != 0 ? "v" : "e") + std::to_string(I));
+        }
+
+        Batch[1]->append("!");
+        ASSERT_EQ(Batch.Values()[0], "v1!");
+        Batch[0].Error() = "replaced";
+        ASSERT_EQ(*Batch.Errors().begin(), "replaced");
+    }
+
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
+    TEST(ExpectedBatch, BadAccess) {
+        ExpectedBatch<int, BatchError> Batch;
+        Batch.EmplaceError(BatchError::Overflow);
+        ASSERT_THROW(static_cast<void>(Batch[0].Value()), BadExpectedAccess<BatchError>);
+    }
+#endif
+}
@@ -0,0 +1,91 @@
+# Checks the object code generated for tests/Codegen/Functions.cpp.
+#
+#   cmake -DOBJDUMP=<objdump> -DOBJECT=<object file> -DEXPECTATIONS=<expectations> -P CheckCodegen.cmake
+#
+# EXPECTATIONS is a list of Name:MaxInstructions[:nobranch] entries, one per function in the stdx::codegen namespace.
+# Every listed function must exist, fit in MaxInstructions, make no calls (tail calls included) and never touch the
+# stack. Functions marked nobranch must not contain any jump either.
+
+foreach (Variable OBJDUMP OBJECT EXPECTATIONS)
+    if (NOT DEFINED ${Variable})
+        message(FATAL_ERROR "${Variable} is not set")
+    endif ()
+endforeach ()
+
+execute_process(
+        COMMAND ${OBJDUMP} -d -C --no-show-raw-insn ${OBJECT}
+        OUTPUT_VARIABLE Disassembly
+        RESULT_VARIABLE Result)
+if (NOT Result EQUAL 0)
+    message(FATAL_ERROR "${OBJDUMP} failed on ${OBJECT}")
+endif ()
+
+string(REPLACE ";" "\;" Disassembly "${Disassembly}")
+string(REPLACE "\n" ";" Lines "${Disassembly}")
+
+set(Current "")
+foreach (Line IN LISTS Lines)
+    if (Line MATCHES "^[0-9a-f]+ <stdx::codegen::([A-Za-z0-9_]+)\\(")
+        set(Current ${CMAKE_MATCH_1})
+        set(Instructions_${Current} "")
+    elseif (Line MATCHES "^[0-9a-f]+ <")
+        set(Current "")
+    elseif (Current AND Line MATCHES "^ *[0-9a-f]+:\t(.*)$")
+        string(STRIP "${CMAKE_MATCH_1}" Instruction)
+        if (NOT Instruction MATCHES "^(nop|xchg +%ax,%ax)")
+            list(APPEND Instructions_${Current} "${Instruction}")
+        endif ()
+    endif ()
+endforeach ()
+
+set(bFailed FALSE)
+foreach (Expectation IN LISTS EXPECTATIONS)
+    string(REPLACE ":" ";" Fields "${Expectation}")
+    list(GET Fields 0 Name)
+    list(GET Fields 1 MaxInstructions)
+    list(LENGTH Fields FieldCount)
+    set(bNoBranch FALSE)
+    if (FieldCount GREATER 2)
+        list(GET Fields 2 Flag)
+        if (Flag STREQUAL "nobranch")
+            set(bNoBranch TRUE)
+        endif ()
+    endif ()
+
+    if (NOT DEFINED Instructions_${Name})
+        message(SEND_ERROR "${Name}: not found in ${OBJECT}")
+        set(bFailed TRUE)
+        continue()
+    endif ()
+
+    set(Problems "")
+    list(LENGTH Instructions_${Name} Count)
+    if (Count GREATER MaxInstructions)
+        list(APPEND Problems "${Count} instructions, at most ${MaxInstructions} expected")
+    endif ()
+    foreach (Instruction IN LISTS Instructions_${Name})
+        if (Instruction MATCHES "^call")
+            list(APPEND Problems "call: ${Instruction}")
+        elseif (Instruction MATCHES "^jmp" AND NOT Instruction MATCHES "<stdx::codegen::${Name}\\(")
+            list(APPEND Problems "tail call: ${Instruction}")
+        elseif (bNoBranch AND Instruction MATCHES "^j")
+            list(APPEND Problems "branch: ${Instruction}")
+        endif ()
+        if (Instruction MATCHES "%[re]?sp|%[re]?bp|^push|^pop")
+            list(APPEND Problems "stack access: ${Instruction}")
+        endif ()
+    endforeach ()
+
+    if (Problems)
+        string(REPLACE ";" "\n    " Problems "${Problems}")
+        string(REPLACE ";" "\n    " Listing "${Instructions_${Name}}")
+        message(SEND_ERROR "${Name}:\n    ${Problems}\n  generated code:\n    ${Listing}")
+        set(bFailed TRUE)
+    else ()
+        message(STATUS "${Name}: ${Count} instructions")
+    endif ()
+endforeach ()
+
+if (bFailed)
+    message(FATAL_ERROR "generated code does not match the expectations")
+endif ()
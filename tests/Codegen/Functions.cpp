@@ -0,0 +1,83 @@
+#include <cstdint>
+#include <utility>
+
+#include <Expected/Expected.hpp>
+#include <Expected/Try.hpp>
+
+// Every function here is checked by CheckCodegen.cmake against the object code the compiler emits at -O2, see the
+// expected-codegen expectations in CMakeLists.txt. They take and return Expected by value on purpose: for trivial
+// T and E the whole object is expected to live in registers.
+namespace stdx::codegen {
+    enum class ErrCode : std::int32_t { Timeout = 1, Refused, Reset };
+
+    using Result = Expected<int, ErrCode>;
+
+    Result ReturnValue(int Value) noexcept {
+        return Value;
+    }
+
+    Result ReturnError(ErrCode Code) noexcept {
+        return Unexpected(Code);
+    }
+
+    Result Copy(const Result& Other) noexcept {
+        Result Copied = Other;
+        return Copied;
+    }
+
+    Result CopyAssign(Result Target, const Result& Other) noexcept {
+        Target = Other;
+        return Target;
+    }
+
+    Result Propagate(Result Input) noexcept {
+        if (!Input.HasValue()) {
+            return Unexpected(Input.Error());
+        }
+        return *Input + 1;
+    }
+
+    Result PropagateTry(Result Input) noexcept {
+        STDX_EXPECTED_TRY_ASSIGN(const int Value, Input);
+        return Value + 1;
+    }
+
+    // An error whose move constructor is not trivial, so that every move of it shows in the code.
+    struct Token {
+        explicit Token(int* Handle) noexcept : Handle(Handle) {}
+
+        Token(Token&& Other) noexcept : Handle(std::exchange(Other.Handle, nullptr)) {}
+
+        int* Handle;
+    };
+
+    using TokenResult = Expected<int, Token>;
+
+    TokenResult PropagateToken(TokenResult&& Input) noexcept {
+        if (!Input.HasValue()) {
+            return Unexpected(std::move(Input).Error());
+        }
+        return *Input + 1;
+    }
+
+    TokenResult PropagateTokenTry(TokenResult&& Input) noexcept {
+        STDX_EXPECTED_TRY_ASSIGN(const int Value, std::move(Input));
+        return Value + 1;
+    }
+
+    int ValueOr(Result Input, int Default) noexcept {
+        return Input.ValueOr(Default);
+    }
+
+    // The two-word cases: returned in RAX:RDX.
+    Expected<void, ErrCode> ReturnVoid(bool bFailed) noexcept {
+        if (bFailed) {
+            return Unexpected(ErrCode::Refused);
+        }
+        return {};
+    }
+
+    Expected<std::int64_t, std::int64_t> ReturnWide(std::int64_t Value) noexcept {
+        return Value;
+    }
+}
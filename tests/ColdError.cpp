@@ -0,0 +1,127 @@
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include <Expected/ColdError.hpp>
+#include <Expected/Expected.hpp>
+
+namespace stdx::tests {
+    // Stands in for rich diagnostics, far larger than the values next to them.
+    struct Diagnostics {
+        Diagnostics(int Code, std::string Message) : Code(Code), Message(std::move(Message)) {}
+
+        [[nodiscard]] friend bool operator==(const Diagnostics& X, const Diagnostics& Y) noexcept {
+            return X.Code == Y.Code && X.Message == Y.Message;
+        }
+
+        int Code;
+        std::string Message;
+        char Context[160] = {};
+    };
+
+    using Cold = ColdError<Diagnostics>;
+
+    static_assert(sizeof(Cold) == sizeof(void*));
+    static_assert(sizeof(Expected<std::int64_t, Cold>) == 2 * sizeof(void*));
+    static_assert(sizeof(Expected<std::int64_t, Diagnostics>) > sizeof(Diagnostics));
+    static_assert(IsTriviallyRelocatable<Expected<std::int64_t, Cold>>());
+    static_assert(std::is_nothrow_move_constructible_v<Expected<std::int64_t, Cold>>);
+#if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || defined(_WIN32)
+    static_assert(sizeof(Expected<void, Cold>) == sizeof(void*));
+#endif
+
+    Expected<std::int64_t, Cold> Parse(std::int64_t Input) {
+        if (Input < 0) {
+            return Unexpected(Diagnostics(22, "negative input"));
+        }
+        return Input * 2;
+    }
+
+    TEST(ColdError, HoldsError) {
+        const Expected<std::int64_t, Cold> Ok = Parse(21);
+        ASSERT_EQ(Ok, 42);
+
+        const Expected<std::int64_t, Cold> Failed = Parse(-1);
+        ASSERT_FALSE(Failed.HasValue());
+        ASSERT_EQ(Failed.Error()->Code, 22);
+        ASSERT_EQ((*Failed.Error()).Message, "negative input");
+
+        const Expected<std::int64_t, Cold> InPlace(unexpect, std::in_place, 22, "negative input");
+        ASSERT_EQ(InPlace, Failed);
+        ASSERT_NE(InPlace, Parse(-2).TransformError([](Cold Error) {
+            Error->Code = 23;
+            return Error;
+        }));
+    }
+
+    TEST(ColdError, CopiesAndMoves) {
+        Cold Error(Diagnostics(1, "first"));
+        Cold Copy(Error);
+        ASSERT_EQ(Copy, Error);
+        ASSERT_NE(&*Copy, &*Error);
+
+        Copy->Code = 2;
+        ASSERT_EQ(Error->Code, 1);
+
+        Cold Moved(std::move(Copy));
+        ASSERT_EQ(Moved->Code, 2);
+
+        Copy = Error;
+        ASSERT_EQ(Copy->Code, 1);
+        Copy = std::move(Moved);
+        ASSERT_EQ(Copy->Code, 2);
+
+        // A moved-from box is empty, and so are its copies.
+        Cold Empty(std::move(Moved));
+        Cold EmptyCopy(Moved);
+        ASSERT_EQ(EmptyCopy, Moved);
+        ASSERT_NE(EmptyCopy, Error);
+        ASSERT_NE(Error, EmptyCopy);
+        EmptyCopy = Moved;
+        Moved = Empty;
+        ASSERT_EQ(Moved->Code, 1);
+
+        Expected<int, Cold> MovedFrom(unexpect, Diagnostics(3, "moved"));
+        const Expected<int, Cold> Taken(std::move(MovedFrom));
+        const Expected<int, Cold> Copied(MovedFrom);
+        ASSERT_EQ(Copied, MovedFrom);
+
+        Expected<void, Cold> Void;
+        ASSERT_TRUE(Void.HasValue());
+        Void = Unexpected(Error);
+        ASSERT_FALSE(Void.HasValue());
+        ASSERT_EQ(Void.Error()->Message, "first");
+        Void = Expected<void, Cold>();
+        ASSERT_TRUE(Void.HasValue());
+    }
+
+    TEST(ColdError, ReusesBlocks) {
+        const void* First = nullptr;
+        {
+            const Cold Error(Diagnostics(1, "reused"));
+            First = &*Error;
+        }
+        const Cold Error(Diagnostics(2, "reused"));
+        ASSERT_EQ(&*Error, First);
+    }
+
+    // Of a size no other test pools, so that the cache of the thread below is only created once Late exists.
+    struct LateError {
+        char Text[72];
+    };
+
+    TEST(ColdError, OutlivesThreadCache) {
+        std::thread([] {
+            // Destroyed after the cache, being constructed before it, so its block goes back to the global allocator.
+            thread_local std::optional<ColdError<LateError>> Late;
+            Late.emplace(LateError{"late"});
+            ColdError<LateError> Cached(LateError{"cached"});
+            static_cast<void>(ColdError<LateError>(std::move(Cached)));
+            ASSERT_STREQ((*Late)->Text, "late");
+        }).join();
+    }
+}
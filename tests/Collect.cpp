@@ -0,0 +1,165 @@
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Expected/Collect.hpp>
+#include <Expected/ParallelCollect.hpp>
+
+namespace stdx::tests {
+    using Results = std::vector<Expected<std::string, std::string>>;
+
+    TEST(Collect, Range) {
+        const Results Ok{std::string("a"), std::string("b"), std::string("c")};
+        ASSERT_EQ(Collect(Ok), (std::vector<std::string>{"a", "b", "c"}));
+        ASSERT_EQ(*Ok[0], "a");
+
+        const Results Failed{std::string("a"), Unexpected(std::string("first")), Unexpected(std::string("second"))};
+        ASSERT_EQ(Collect(Failed), Unexpected(std::string("first")));
+        ASSERT_EQ(Collect(Results()), std::vector<std::string>());
+
+        const std::list<Expected<int, int>> List{1, 2, 3};
+        ASSERT_EQ(Collect(List), (std::vector<int>{1, 2, 3}));
+
+        const Expected<void, int> Void[] = {Expected<void, int>(), Unexpected(7)};
+        ASSERT_EQ(Collect(Void), Unexpected(7));
+        ASSERT_TRUE(Collect(std::vector<Expected<void, int>>(3)).HasValue());
+    }
+
+    TEST(Collect, MovesFromRvalues) {
+        Results Ok{std::string(64, 'a'), std::string(64, 'b')};
+        const char* const Data = Ok[1]->data();
+        const auto Collected = Collect(std::move(Ok));
+        ASSERT_EQ((*Collected)[1].data(), Data);
+
+        std::vector<Expected<std::unique_ptr<int>, std::string>> Owning;
+        Owning.emplace_back(std::make_unique<int>(1));
+        Owning.emplace_back(std::make_unique<int>(2));
+        auto Pointers = Collect(std::move(Owning));
+        ASSERT_EQ(*(*Pointers)[1], 2);
+    }
+
+    TEST(Collect, Sequence) {
+        const Expected<int, std::string> Number = 42;
+        const Expected<std::string, std::string> Text = std::string("text");
+        ASSERT_EQ(Sequence(std::forward_as_tuple(Number, Text)), std::make_tuple(42, std::string("text")));
+
+        const Expected<double, std::string> Missing = Unexpected(std::string("missing"));
+        ASSERT_EQ(Sequence(std::make_tuple(Number, Missing, Text)), Unexpected(std::string("missing")));
+        ASSERT_EQ(Sequence(std::make_pair(Number, Number)), std::make_tuple(42, 42));
+
+        constexpr std::array<Expected<int, int>, 2> Array{Expected<int, int>(1), Expected<int, int>(unexpect, 2)};
+        static_assert(Sequence(Array) == Unexpected(2));
+    }
+
+    // Has no default constructor, so ParallelCollect constructs it in place instead of assigning it.
+    struct Measurement {
+        explicit Measurement(std::size_t Index) : Index(Index) {}
+
+        std::size_t Index;
+    };
+
+    TEST(Collect, Parallel) {
+        ThreadPool Pool(4);
+        ASSERT_EQ(Pool.Size(), 4);
+
+        const auto Squares = ParallelCollect(Pool, 1000, [](std::size_t I) -> Expected<std::size_t, std::string> {
+            return I * I;
+        });
+        ASSERT_TRUE(Squares.HasValue());
+        for (std::size_t I = 0; I < 1000; ++I) {
+            ASSERT_EQ((*Squares)[I], I * I);
+        }
+
+        const auto Measurements = ParallelCollect(Pool, 100, [](std::size_t I) -> Expected<Measurement, std::string> {
+            return Measurement(I);
+        });
+        ASSERT_EQ(Measurements->size(), 100);
+        ASSERT_EQ(Measurements->back().Index, 99);
+
+        // std::vector<bool> shares words between elements, so the values go through slots of their own.
+        const auto Parities = ParallelCollect(
+            Pool,
+            4096,
+            [](std::size_t I) {
+                return Expected<bool, int>(I % 2 == 0);
+            },
+            1);
+        ASSERT_EQ(Parities->size(), 4096);
+        for (std::size_t I = 0; I < 4096; ++I) {
+            ASSERT_EQ((*Parities)[I], I % 2 == 0);
+        }
+
+        // Whichever fails first in time, the error reported is the one of the lowest failing index.
+        for (std::size_t Chunk : {1, 7, 64}) {
+            const auto Failed = ParallelCollect(
+                Pool,
+                10000,
+                [](std::size_t I) -> Expected<std::size_t, std::string> {
+                    if (I % 1000 == 999) {
+                        return Unexpected(std::to_string(I));
+                    }
+                    return I;
+                },
+                Chunk);
+            ASSERT_EQ(Failed, Unexpected(std::string("999")));
+        }
+
+        std::vector<std::function<Expected<void, int>()>> Tasks(50, [] { return Expected<void, int>(); });
+        ASSERT_TRUE(ParallelCollect(Pool, Tasks).HasValue());
+        Tasks[30] = [] { return Expected<void, int>(unexpect, 30); };
+        Tasks[20] = [] { return Expected<void, int>(unexpect, 20); };
+        ASSERT_EQ(ParallelCollect(Pool, Tasks), Unexpected(20));
+    }
+
+    TEST(Collect, ParallelCancels) {
+        // On a single thread the tasks run in order, so none runs past the failing one.
+        ThreadPool Single(1);
+        std::size_t Started = 0;
+        const auto Failed = ParallelCollect(Single, 1000, [&Started](std::size_t I) -> Expected<int, int> {
+            ++Started;
+            return I == 10 ? Expected<int, int>(unexpect, 10) : Expected<int, int>(int(I));
+        });
+        ASSERT_EQ(Failed, Unexpected(10));
+        ASSERT_EQ(Started, 11);
+
+        // With more threads, every task before the failing one still runs.
+        ThreadPool Pool(4);
+        std::atomic<std::size_t> Before{0};
+        const auto Again = ParallelCollect(Pool, 100000, [&Before](std::size_t I) -> Expected<int, int> {
+            if (I < 500) {
+                Before.fetch_add(1, std::memory_order_relaxed);
+            }
+            return I == 500 ? Expected<int, int>(unexpect, 500) : Expected<int, int>(int(I));
+        });
+        ASSERT_EQ(Again, Unexpected(500));
+        ASSERT_EQ(Before.load(), 500);
+    }
+
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
+    TEST(Collect, ParallelRethrows) {
+        ThreadPool Pool(3);
+        const auto Throwing = [](std::size_t I) -> Expected<int, int> {
+            if (I == 40) {
+                throw std::runtime_error("task 40");
+            }
+            return I == 60 ? Expected<int, int>(unexpect, 60) : Expected<int, int>(int(I));
+        };
+        ASSERT_THROW(static_cast<void>(ParallelCollect(Pool, 100, Throwing)), std::runtime_error);
+
+        // An error at a lower index wins over the exception.
+        ASSERT_EQ(ParallelCollect(Pool, 100, [&Throwing](std::size_t I) {
+            return I == 20 ? Expected<int, int>(unexpect, 20) : Throwing(I);
+        }), Unexpected(20));
+    }
+#endif
+}
@@ -0,0 +1,159 @@
+#include <array>
+#include <initializer_list>
+#include <string_view>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::tests {
+    // Built as C++20 only: every operation below switches the active alternative during constant evaluation.
+    // Config has non-trivial special members, so the user-provided ones of Expected are the ones evaluated.
+    struct Config {
+        constexpr Config(int InPort, int InThreads = 1) noexcept : Port(InPort), Threads(InThreads) {}
+
+        constexpr Config(std::initializer_list<int> List) noexcept : Port(*List.begin()), Threads(int(List.size())) {}
+
+        constexpr Config(const Config& Other) noexcept : Port(Other.Port), Threads(Other.Threads) {}
+
+        constexpr Config& operator=(const Config& Other) noexcept {
+            Port = Other.Port;
+            Threads = Other.Threads;
+            return *this;
+        }
+
+        constexpr ~Config() {}
+
+        friend constexpr bool operator==(const Config& X, const Config& Y) noexcept {
+            return X.Port == Y.Port && X.Threads == Y.Threads;
+        }
+
+        int Port;
+        int Threads;
+    };
+
+    enum class ParseError { Empty, NotANumber };
+
+    using Parsed = Expected<Config, ParseError>;
+
+    constexpr Parsed ParsePort(std::string_view Text) noexcept {
+        if (Text.empty()) {
+            return Unexpected(ParseError::Empty);
+        }
+
+        int Port = 0;
+        for (char C : Text) {
+            if (C < '0' || C > '9') {
+                return Unexpected(ParseError::NotANumber);
+            }
+            Port = Port * 10 + (C - '0');
+        }
+        return Config(Port);
+    }
+
+    constexpr std::array<Parsed, 3> Table = {ParsePort("8080"), ParsePort(""), ParsePort("80a")};
+
+    static_assert(Table[0] == Config(8080));
+    static_assert(Table[1] == Unexpected(ParseError::Empty));
+    static_assert(Table[2] == Unexpected(ParseError::NotANumber));
+
+    constexpr bool CopyAndMove() {
+        Parsed Value = Config(1);
+        Parsed Error = Unexpected(ParseError::Empty);
+
+        Parsed Copy = Value;
+        Parsed Moved = std::move(Error);
+        Expected<Config, int> Converted = Expected<Config, short>(Unexpected<short>(7));
+        return Copy == Config(1) && Moved == Unexpected(ParseError::Empty) && Converted.Error() == 7;
+    }
+
+    static_assert(CopyAndMove());
+
+    constexpr bool CopyAssignment() {
+        Parsed Value = Config(1);
+        Parsed Error = Unexpected(ParseError::Empty);
+
+        Parsed X = Config(2);
+        X = Value;
+        bool bResult = X == Config(1);
+        X = Error;
+        bResult = bResult && X == Unexpected(ParseError::Empty);
+        X = Error;
+        bResult = bResult && X == Unexpected(ParseError::Empty);
+        X = Value;
+        return bResult && X == Config(1);
+    }
+
+    static_assert(CopyAssignment());
+
+    constexpr bool MoveAssignment() {
+        Parsed X = Unexpected(ParseError::Empty);
+        X = Parsed(Config(1));
+        bool bResult = X == Config(1);
+        X = Parsed(Unexpected(ParseError::NotANumber));
+        return bResult && X == Unexpected(ParseError::NotANumber);
+    }
+
+    static_assert(MoveAssignment());
+
+    constexpr bool ValueAndUnexpectedAssignment() {
+        const Unexpected<ParseError> Unex(ParseError::Empty);
+
+        Parsed X = Config(1);
+        X = Unex;
+        bool bResult = X == Unexpected(ParseError::Empty);
+        X = Unexpected(ParseError::NotANumber);
+        bResult = bResult && X == Unexpected(ParseError::NotANumber);
+        X = Config(2);
+        bResult = bResult && X == Config(2);
+        X = Config(3);
+        return bResult && X == Config(3);
+    }
+
+    static_assert(ValueAndUnexpectedAssignment());
+
+    constexpr bool Emplace() {
+        Parsed X = Unexpected(ParseError::Empty);
+        X.Emplace(1, 2);
+        bool bResult = X == Config(1, 2);
+        X.Emplace({3, 4, 5});
+        bResult = bResult && X == Config(3, 3);
+
+        Expected<void, ParseError> Void = Unexpected(ParseError::Empty);
+        Void.Emplace();
+        return bResult && Void.HasValue();
+    }
+
+    static_assert(Emplace());
+
+    constexpr bool Swap() {
+        Parsed X = Config(1);
+        Parsed Y = Config(2);
+        X.Swap(Y);
+        bool bResult = X == Config(2) && Y == Config(1);
+
+        Parsed Z = Unexpected(ParseError::Empty);
+        X.Swap(Z);
+        bResult = bResult && X == Unexpected(ParseError::Empty) && Z == Config(2);
+        X.Swap(Z);
+        bResult = bResult && X == Config(2) && Z == Unexpected(ParseError::Empty);
+
+        Parsed W = Unexpected(ParseError::NotANumber);
+        swap(Z, W);
+        bResult = bResult && Z == Unexpected(ParseError::NotANumber) && W == Unexpected(ParseError::Empty);
+
+        Expected<void, ParseError> Void;
+        Expected<void, ParseError> VoidError = Unexpected(ParseError::Empty);
+        Void.Swap(VoidError);
+        return bResult && !Void.HasValue() && VoidError.HasValue();
+    }
+
+    static_assert(Swap());
+
+    TEST(Constexpr, Table) {
+        ASSERT_EQ(Table[0]->Port, 8080);
+        ASSERT_EQ(Table[1].Error(), ParseError::Empty);
+        ASSERT_EQ(Table[2].Error(), ParseError::NotANumber);
+    }
+}
@@ -0,0 +1,86 @@
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <gtest/gtest.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::tests {
+    struct Unhashable {};
+
+    static_assert(std::is_default_constructible_v<std::hash<Expected<int, std::string>>>);
+    static_assert(std::is_default_constructible_v<std::hash<Expected<void, int>>>);
+    static_assert(std::is_default_constructible_v<std::hash<Expected<const std::string&, int>>>);
+    static_assert(std::is_default_constructible_v<std::hash<Unexpected<int>>>);
+    static_assert(!std::is_default_constructible_v<std::hash<Expected<Unhashable, int>>>);
+    static_assert(!std::is_default_constructible_v<std::hash<Expected<int, Unhashable>>>);
+    static_assert(!std::is_default_constructible_v<std::hash<Unexpected<Unhashable>>>);
+
+    TEST(Containers, Hash) {
+        using Ex = Expected<int, int>;
+        const std::hash<Ex> Hash;
+
+        ASSERT_EQ(Hash(Ex(42)), Hash(Ex(42)));
+        ASSERT_NE(Hash(Ex(42)), Hash(Ex(unexpect, 42)));
+        ASSERT_EQ(std::hash<Unexpected<int>>()(Unexpected(7)), std::hash<int>()(7));
+
+        std::string Name = "name";
+        const std::hash<Expected<std::string&, int>> ReferenceHash;
+        const std::hash<Expected<std::string, int>> ValueHash;
+        ASSERT_EQ(ReferenceHash(Name), ValueHash(Name));
+
+        const std::hash<Expected<void, int>> VoidHash;
+        ASSERT_EQ(VoidHash(Expected<void, int>()), VoidHash(Expected<void, int>()));
+        ASSERT_NE(VoidHash(Expected<void, int>()), VoidHash(Expected<void, int>(unexpect, 0)));
+    }
+
+    TEST(Containers, Unordered) {
+        std::unordered_set<Expected<std::string, int>> Results;
+        Results.insert(Expected<std::string, int>("value"));
+        Results.insert(Expected<std::string, int>(unexpect, 404));
+        Results.insert(Expected<std::string, int>("value"));
+        ASSERT_EQ(Results.size(), 2u);
+        ASSERT_EQ(Results.count(Expected<std::string, int>(unexpect, 404)), 1u);
+
+        std::unordered_map<Unexpected<int>, std::string> Messages;
+        Messages.emplace(Unexpected(404), "not found");
+        ASSERT_EQ(Messages.at(Unexpected(404)), "not found");
+    }
+
+    TEST(Containers, Order) {
+        using Ex = Expected<int, int>;
+
+        ASSERT_LT(Ex(1), Ex(2));
+        ASSERT_LT(Ex(2), Ex(unexpect, 1));
+        ASSERT_LT(Ex(unexpect, 1), Ex(unexpect, 2));
+        ASSERT_FALSE(Ex(unexpect, 1) < Ex(2));
+        ASSERT_GT(Ex(unexpect, 1), Ex(2));
+        ASSERT_LE(Ex(1), Ex(1));
+        ASSERT_GE(Ex(unexpect, 1), Ex(unexpect, 1));
+
+        using Void = Expected<void, int>;
+        ASSERT_FALSE(Void() < Void());
+        ASSERT_LE(Void(), Void());
+        ASSERT_LT(Void(), Void(unexpect, 1));
+        ASSERT_GT(Void(unexpect, 2), Void(unexpect, 1));
+        static_assert(noexcept(Void() < Void()));
+        ASSERT_EQ((std::set<Void>{Void(unexpect, 1), Void(), Void()}.size()), 2);
+
+        ASSERT_LT(Unexpected(1), Unexpected(2));
+        ASSERT_GE(Unexpected(2), Unexpected(2));
+
+        std::set<Ex> Sorted = {Ex(unexpect, 2), Ex(3), Ex(unexpect, 1), Ex(1)};
+        ASSERT_EQ(*Sorted.begin(), Ex(1));
+        ASSERT_EQ(*Sorted.rbegin(), Ex(unexpect, 2));
+
+        std::map<Unexpected<std::string>, int> Counts;
+        ++Counts[Unexpected<std::string>("timeout")];
+        ++Counts[Unexpected<std::string>("timeout")];
+        ASSERT_EQ(Counts.begin()->second, 2);
+    }
+}
@@ -0,0 +1,125 @@
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Expected/Coroutine.hpp>
+
+#if defined(STDX_EXPECTED_HAS_COROUTINES)
+#include "Utility.hpp"
+
+namespace stdx::tests {
+    Expected<int, std::string> Parse(const std::string& Text) {
+        if (Text.empty() || Text.find_first_not_of("0123456789") != std::string::npos) {
+            return Unexpected("not a number: " + Text);
+        }
+        return std::stoi(Text);
+    }
+
+    Expected<int, std::string> Sum(const std::string& A, const std::string& B) {
+        int X = co_await Parse(A);
+        int Y = co_await Parse(B);
+        co_return X + Y;
+    }
+
+    Expected<void, std::string> Check(const std::string& A) {
+        int X = co_await Parse(A);
+        if (X > 100) {
+            co_return co_await Expected<void, std::string>(unexpect, "too large");
+        }
+    }
+
+    TEST(Coroutine, CoAwait) {
+        {
+            Expected<int, std::string> Ex = Sum("40", "2");
+            ASSERT_TRUE(Ex.HasValue());
+            ASSERT_EQ(*Ex, 42);
+        }
+
+        {
+            Expected<int, std::string> Ex = Sum("40", "x");
+            ASSERT_FALSE(Ex.HasValue());
+            ASSERT_EQ(Ex.Error(), "not a number: x");
+        }
+
+        {
+            ASSERT_TRUE(Check("7").HasValue());
+            ASSERT_EQ(Check("700").Error(), "too large");
+            ASSERT_EQ(Check("").Error(), "not a number: ");
+        }
+    }
+
+    TEST(Coroutine, Lvalues) {
+        const Expected<std::string, int> Name = "world";
+        Expected<std::unique_ptr<int>, int> Pointer = std::make_unique<int>(42);
+
+        auto Greet = [&]() -> Expected<std::string, long> {
+            const std::string& Value = co_await Name;
+            std::unique_ptr<int> Owned = co_await std::move(Pointer);
+            co_return Value + " " + std::to_string(*Owned);
+        };
+
+        Expected<std::string, long> Ex = Greet();
+        ASSERT_EQ(*Ex, "world 42");
+        ASSERT_EQ(*Name, "world");
+        ASSERT_EQ(*Pointer, nullptr);
+    }
+
+    TEST(Coroutine, Unexpected) {
+        auto Fail = []() -> Expected<int, std::string> {
+            co_return Unexpected("failed");
+        };
+        ASSERT_EQ(Fail().Error(), "failed");
+    }
+
+    TEST(Coroutine, NoTemporaries) {
+        auto Make = []() -> Expected<Counted, int> {
+            co_return Counted(1);
+        };
+        auto Forward = [&]() -> Expected<Counted, int> {
+            Counted Value = co_await Make();
+            co_return std::move(Value);
+        };
+
+        Counted::Reset();
+        Expected<Counted, int> Ex = Forward();
+        ASSERT_EQ(Ex->Value, 1);
+        ASSERT_EQ(Counted::Copies, 0);
+    }
+
+    Expected<int, int> Depth(std::allocator_arg_t, CoroutineArena& Arena, int N) {
+        if (N == 0) {
+            co_return 0;
+        }
+        co_return 1 + co_await Depth(std::allocator_arg, Arena, N - 1);
+    }
+
+    Expected<std::size_t, int> Used(std::allocator_arg_t, CoroutineArena& Arena) {
+        co_return Arena.Used();
+    }
+
+    TEST(Coroutine, Arena) {
+        alignas(CoroutineArena::Alignment) unsigned char Buffer[4096];
+        CoroutineArena Arena(Buffer, sizeof(Buffer));
+
+        ASSERT_GT(*Used(std::allocator_arg, Arena), 0);
+        ASSERT_EQ(*Depth(std::allocator_arg, Arena, 5), 5);
+        ASSERT_EQ(Arena.Used(), 0);
+
+        // The unaligned head of a buffer is skipped.
+        CoroutineArena Unaligned(Buffer + 1, sizeof(Buffer) - 1);
+        ASSERT_EQ(Unaligned.Capacity(), sizeof(Buffer) - CoroutineArena::Alignment);
+        ASSERT_EQ(*Depth(std::allocator_arg, Unaligned, 5), 5);
+        ASSERT_EQ(Unaligned.Used(), 0);
+
+        // Frames that do not fit fall back to the heap, and are still released in order.
+        ASSERT_EQ(*Depth(std::allocator_arg, Arena, 200), 200);
+        ASSERT_EQ(Arena.Used(), 0);
+    }
+
+    TEST(Coroutine, FrameStack) {
+        ASSERT_EQ(*Sum("1", "2"), 3);
+        ASSERT_EQ(details::FrameStack().Used(), 0);
+    }
+}
+#endif
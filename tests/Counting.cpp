@@ -0,0 +1,379 @@
+#include <ostream>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <Expected/Expected.hpp>
+#include <Expected/Try.hpp>
+
+namespace stdx::tests {
+    // Special member calls made on an instrumented type, plus the buffers it allocated.
+    struct Operations {
+        Operations& Construct() noexcept {
+            ++Constructions;
+            return *this;
+        }
+
+        Operations& Copy() noexcept {
+            ++Copies;
+            return *this;
+        }
+
+        Operations& Move() noexcept {
+            ++Moves;
+            return *this;
+        }
+
+        Operations& CopyAssign() noexcept {
+            ++CopyAssignments;
+            return *this;
+        }
+
+        Operations& MoveAssign() noexcept {
+            ++MoveAssignments;
+            return *this;
+        }
+
+        Operations& Destroy() noexcept {
+            ++Destructions;
+            return *this;
+        }
+
+        Operations& Allocate() noexcept {
+            ++Allocations;
+            return *this;
+        }
+
+        friend bool operator==(const Operations& X, const Operations& Y) noexcept {
+            return X.Constructions == Y.Constructions && X.Copies == Y.Copies && X.Moves == Y.Moves &&
+                   X.CopyAssignments == Y.CopyAssignments && X.MoveAssignments == Y.MoveAssignments &&
+                   X.Destructions == Y.Destructions && X.Allocations == Y.Allocations;
+        }
+
+        friend std::ostream& operator<<(std::ostream& Stream, const Operations& X) {
+            return Stream << "{construct " << X.Constructions << ", copy " << X.Copies << ", move " << X.Moves
+                          << ", copy-assign " << X.CopyAssignments << ", move-assign " << X.MoveAssignments << ", destroy "
+                          << X.Destructions << ", allocate " << X.Allocations << "}";
+        }
+
+        int Constructions = 0;
+        int Copies = 0;
+        int Moves = 0;
+        int CopyAssignments = 0;
+        int MoveAssignments = 0;
+        int Destructions = 0;
+        int Allocations = 0;
+    };
+
+    // Behaves like a container: constructing and copying allocate and may throw, moving steals the buffer, and copy
+    // assignment reuses the buffer already owned by the target.
+    template <int Tag>
+    struct Instrumented {
+        explicit Instrumented(int Value) noexcept(false) : Value(Value) {
+            Log.Construct().Allocate();
+        }
+
+        Instrumented(const Instrumented& Other) noexcept(false) : Value(Other.Value) {
+            Log.Copy().Allocate();
+        }
+
+        Instrumented(Instrumented&& Other) noexcept : Value(Other.Value), bOwnsBuffer(std::exchange(Other.bOwnsBuffer, false)) {
+            Log.Move();
+        }
+
+        Instrumented& operator=(const Instrumented& Other) noexcept(false) {
+            Log.CopyAssign();
+            if (!bOwnsBuffer) {
+                Log.Allocate();
+                bOwnsBuffer = true;
+            }
+            Value = Other.Value;
+            return *this;
+        }
+
+        Instrumented& operator=(Instrumented&& Other) noexcept {
+            Log.MoveAssign();
+            bOwnsBuffer = std::exchange(Other.bOwnsBuffer, false);
+            Value = Other.Value;
+            return *this;
+        }
+
+        ~Instrumented() {
+            Log.Destroy();
+        }
+
+        int Value;
+        bool bOwnsBuffer = true;
+
+        static inline Operations Log;
+    };
+
+    using Value = Instrumented<0>;
+    using Error = Instrumented<1>;
+
+    // Without exceptions there is nothing to roll back, so the backup copies of the current alternative disappear.
+    constexpr bool bBackups = details::ExceptionsEnabled();
+
+    void ResetLogs() noexcept {
+        Value::Log = {};
+        Error::Log = {};
+    }
+
+    TEST(Counting, Construction) {
+        const Value V(1);
+        const Unexpected<Error> U(std::in_place, 2);
+
+        ResetLogs();
+        {
+            Expected<Value, Error> Ex(std::in_place, 1);
+            ASSERT_EQ(Value::Log, Operations().Construct().Allocate());
+        }
+
+        ResetLogs();
+        {
+            Expected<Value, Error> Ex(V);
+            ASSERT_EQ(Value::Log, Operations().Copy().Allocate());
+        }
+
+        ResetLogs();
+        {
+            Value Tmp(1);
+            ResetLogs();
+            Expected<Value, Error> Ex(std::move(Tmp));
+            ASSERT_EQ(Value::Log, Operations().Move());
+        }
+
+        ResetLogs();
+        {
+            Expected<Value, Error> Ex(unexpect, 2);
+            ASSERT_EQ(Error::Log, Operations().Construct().Allocate());
+            ASSERT_EQ(Value::Log, Operations());
+        }
+
+        ResetLogs();
+        {
+            Expected<Value, Error> Ex(U);
+            ASSERT_EQ(Error::Log, Operations().Copy().Allocate());
+        }
+
+        ResetLogs();
+        {
+            Unexpected<Error> Tmp(std::in_place, 2);
+            ResetLogs();
+            Expected<Value, Error> Ex(std::move(Tmp));
+            ASSERT_EQ(Error::Log, Operations().Move());
+        }
+    }
+
+    TEST(Counting, CopyAndMove) {
+        const Expected<Value, Error> WithValue(std::in_place, 1);
+        const Expected<Value, Error> WithError(unexpect, 2);
+
+        ResetLogs();
+        {
+            Expected<Value, Error> Ex(WithValue);
+            ASSERT_EQ(Value::Log, Operations().Copy().Allocate());
+            ASSERT_EQ(Error::Log, Operations());
+        }
+
+        ResetLogs();
+        {
+            Expected<Value, Error> Ex(WithError);
+            ASSERT_EQ(Error::Log, Operations().Copy().Allocate());
+            ASSERT_EQ(Value::Log, Operations());
+        }
+
+        ResetLogs();
+        {
+            Expected<Value, Error> From(std::in_place, 1);
+            ResetLogs();
+            Expected<Value, Error> Ex(std::move(From));
+            ASSERT_EQ(Value::Log, Operations().Move());
+        }
+
+        ResetLogs();
+        {
+            Expected<Value, Error> From(unexpect, 2);
+            ResetLogs();
+            Expected<Value, Error> Ex(std::move(From));
+            ASSERT_EQ(Error::Log, Operations().Move());
+        }
+    }
+
+    TEST(Counting, CopyAssignment) {
+        const Expected<Value, Error> WithValue(std::in_place, 1);
+        const Expected<Value, Error> WithError(unexpect, 2);
+
+        // Same alternative on both sides: assigned in place, reusing the target's buffer.
+        {
+            Expected<Value, Error> Ex(std::in_place, 3);
+            ResetLogs();
+            Ex = WithValue;
+            ASSERT_EQ(Value::Log, Operations().CopyAssign());
+            ASSERT_EQ(Ex->Value, 1);
+        }
+
+        {
+            Expected<Value, Error> Ex(unexpect, 3);
+            ResetLogs();
+            Ex = WithError;
+            ASSERT_EQ(Error::Log, Operations().CopyAssign());
+            ASSERT_EQ(Ex.Error().Value, 2);
+        }
+
+        // Switching alternatives copies the source aside first, so that a throwing copy leaves the target untouched.
+        {
+            Expected<Value, Error> Ex(unexpect, 3);
+            ResetLogs();
+            Ex = WithValue;
+            ASSERT_EQ(Error::Log, Operations().Destroy());
+            if constexpr (bBackups) {
+                ASSERT_EQ(Value::Log, Operations().Copy().Allocate().Move().Destroy());
+            } else {
+                ASSERT_EQ(Value::Log, Operations().Copy().Allocate());
+            }
+        }
+
+        {
+            Expected<Value, Error> Ex(std::in_place, 3);
+            ResetLogs();
+            Ex = WithError;
+            ASSERT_EQ(Value::Log, Operations().Destroy());
+            if constexpr (bBackups) {
+                ASSERT_EQ(Error::Log, Operations().Copy().Allocate().Move().Destroy());
+            } else {
+                ASSERT_EQ(Error::Log, Operations().Copy().Allocate());
+            }
+        }
+    }
+
+    TEST(Counting, MoveAssignment) {
+        {
+            Expected<Value, Error> Ex(std::in_place, 3);
+            Expected<Value, Error> From(std::in_place, 1);
+            ResetLogs();
+            Ex = std::move(From);
+            ASSERT_EQ(Value::Log, Operations().MoveAssign());
+        }
+
+        {
+            Expected<Value, Error> Ex(unexpect, 3);
+            Expected<Value, Error> From(unexpect, 1);
+            ResetLogs();
+            Ex = std::move(From);
+            ASSERT_EQ(Error::Log, Operations().MoveAssign());
+        }
+
+        {
+            Expected<Value, Error> Ex(unexpect, 3);
+            Expected<Value, Error> From(std::in_place, 1);
+            ResetLogs();
+            Ex = std::move(From);
+            ASSERT_EQ(Error::Log, Operations().Destroy());
+            ASSERT_EQ(Value::Log, Operations().Move());
+        }
+
+        {
+            Expected<Value, Error> Ex(std::in_place, 3);
+            Expected<Value, Error> From(unexpect, 1);
+            ResetLogs();
+            Ex = std::move(From);
+            ASSERT_EQ(Value::Log, Operations().Destroy());
+            ASSERT_EQ(Error::Log, Operations().Move());
+        }
+    }
+
+    TEST(Counting, AssignmentFromAlternative) {
+        {
+            const Value V(1);
+            Expected<Value, Error> Ex(std::in_place, 3);
+            ResetLogs();
+            Ex = V;
+            ASSERT_EQ(Value::Log, Operations().CopyAssign());
+        }
+
+        {
+            Value V(1);
+            Expected<Value, Error> Ex(std::in_place, 3);
+            ResetLogs();
+            Ex = std::move(V);
+            ASSERT_EQ(Value::Log, Operations().MoveAssign());
+        }
+
+        {
+            const Unexpected<Error> U(std::in_place, 1);
+            Expected<void, Error> Ex(unexpect, 3);
+            ResetLogs();
+            Ex = U;
+            ASSERT_EQ(Error::Log, Operations().CopyAssign());
+        }
+
+        {
+            Unexpected<Error> U(std::in_place, 1);
+            Expected<Value, Error> Ex(unexpect, 3);
+            ResetLogs();
+            Ex = std::move(U);
+            ASSERT_EQ(Error::Log, Operations().MoveAssign());
+        }
+    }
+
+    TEST(Counting, Emplace) {
+        // Replacing a value goes through a temporary: the current value survives a throwing constructor.
+        {
+            Expected<Value, Error> Ex(std::in_place, 3);
+            ResetLogs();
+            Ex.Emplace(1);
+            if constexpr (bBackups) {
+                ASSERT_EQ(Value::Log, Operations().Construct().Allocate().MoveAssign().Destroy());
+            } else {
+                ASSERT_EQ(Value::Log, Operations().Destroy().Construct().Allocate());
+            }
+        }
+
+        {
+            Expected<Value, Error> Ex(unexpect, 3);
+            ResetLogs();
+            Ex.Emplace(1);
+            ASSERT_EQ(Error::Log, Operations().Destroy());
+            if constexpr (bBackups) {
+                ASSERT_EQ(Value::Log, Operations().Construct().Allocate().Move().Destroy());
+            } else {
+                ASSERT_EQ(Value::Log, Operations().Construct().Allocate());
+            }
+        }
+    }
+
+    Expected<int, Error> FailWithError() {
+        return Expected<int, Error>(unexpect, 2);
+    }
+
+    Expected<Value, Error> PropagateByHand() {
+        Expected<int, Error> Result = FailWithError();
+        if (!Result.HasValue()) {
+            return Unexpected(std::move(Result).Error());
+        }
+        return Value(*Result);
+    }
+
+    Expected<Value, Error> PropagateWithTry() {
+        STDX_EXPECTED_TRY_ASSIGN(const int Parsed, FailWithError());
+        return Value(Parsed);
+    }
+
+    TEST(Counting, Propagation) {
+        // By hand, the error is moved into a temporary Unexpected and from there into the result.
+        ResetLogs();
+        {
+            const Expected<Value, Error> Ex = PropagateByHand();
+            ASSERT_EQ(Error::Log, Operations().Construct().Allocate().Move().Move().Destroy().Destroy());
+        }
+
+        // The propagation macros move it straight into the result.
+        ResetLogs();
+        {
+            const Expected<Value, Error> Ex = PropagateWithTry();
+            ASSERT_EQ(Error::Log, Operations().Construct().Allocate().Move().Destroy());
+        }
+        ASSERT_EQ(Value::Log, Operations());
+    }
+}
@@ -0,0 +1,122 @@
+#include <cstdint>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::tests {
+#if !defined(STDX_EXPECTED_ERROR_HOOKS)
+#error "this file must be compiled with STDX_EXPECTED_ERROR_HOOKS defined"
+#endif
+
+    enum class HookError { Refused, Timeout };
+
+    struct HookPayload {
+        HookPayload(int Code, std::string Message) : Code(Code), Message(std::move(Message)) {}
+
+        int Code;
+        std::string Message;
+    };
+
+    // The number of errors counted so far whose type names Type and that were created at Line of this file.
+    std::uint64_t CountAt(const std::string& Type, std::uint_least32_t Line) {
+        std::uint64_t Count = 0;
+        for (const ErrorCount& Counted : SnapshotErrorCounts()) {
+            if (Counted.Type.find(Type) != std::string::npos && Counted.Site.Line == Line && Counted.Site.File != nullptr &&
+                std::string(Counted.Site.File).find("ErrorHooks.cpp") != std::string::npos) {
+                Count += Counted.Count;
+            }
+        }
+        return Count;
+    }
+
+    std::uint64_t CountAll(const std::string& Type) {
+        std::uint64_t Count = 0;
+        for (const ErrorCount& Counted : SnapshotErrorCounts()) {
+            if (Counted.Type.find(Type) != std::string::npos) {
+                Count += Counted.Count;
+            }
+        }
+        return Count;
+    }
+
+    Expected<int, HookError> Connect(bool bRefused) {
+        if (bRefused) {
+            return Unexpected(HookError::Refused);
+        }
+        return 42;
+    }
+
+    constexpr std::uint_least32_t ConnectLine = __LINE__ - 5;
+
+    TEST(ErrorHooks, CountsPerSite) {
+        const std::uint64_t Before = CountAt("HookError", ConnectLine);
+        for (int I = 0; I < 10; ++I) {
+            static_cast<void>(Connect(I % 2 == 0));
+        }
+        ASSERT_EQ(CountAt("HookError", ConnectLine), Before + 5);
+
+        const Expected<int, HookError> Ex(unexpect, HookError::Timeout);
+        ASSERT_EQ(CountAt("HookError", __LINE__ - 1), 1u);
+
+        const Unexpected<HookPayload> Unex(std::in_place, 404, "not found");
+        ASSERT_EQ(CountAt("HookPayload", __LINE__ - 1), 1u);
+
+        const Expected<void, HookPayload> Void(unexpect, 500, "internal");
+        ASSERT_EQ(CountAt("HookPayload", __LINE__ - 1), 1u);
+    }
+
+    TEST(ErrorHooks, CountsOnlyOrigins) {
+        Expected<std::string, HookError> Ex = Unexpected(HookError::Timeout);
+        const std::uint64_t Before = CountAll("HookError");
+
+        Expected<std::string, HookError> Copy = Ex;
+        Expected<std::string, HookError> Moved = std::move(Copy);
+        Moved = Ex;
+        Ex.Swap(Moved);
+        const Expected<int, HookError> Converted = Ex.Transform([](const std::string& S) { return int(S.size()); });
+        const Expected<int, HookError> Chained = Converted.AndThen([](int X) { return Expected<int, HookError>(X); });
+        const Unexpected<HookError> Unex(Chained.Error());
+        static_cast<void>(Unex);
+
+        ASSERT_EQ(CountAll("HookError"), Before + 1);
+    }
+
+    TEST(ErrorHooks, AggregatesFinishedThreads) {
+        const std::uint64_t Before = CountAt("HookError", ConnectLine);
+        std::thread Worker([] {
+            for (int I = 0; I < 100; ++I) {
+                static_cast<void>(Connect(true));
+            }
+        });
+        Worker.join();
+        ASSERT_EQ(CountAt("HookError", ConnectLine), Before + 100);
+    }
+
+    int HookCalls = 0;
+
+    TEST(ErrorHooks, CallsHook) {
+        ErrorHook Previous = SetErrorHook([](const char* Type, const ErrorSite& Site) {
+            if (std::string(Type) == "stdx::tests::HookError" && Site.Line == ConnectLine) {
+                ++HookCalls;
+            }
+        });
+        ASSERT_EQ(Previous, nullptr);
+
+        static_cast<void>(Connect(true));
+        static_cast<void>(Connect(false));
+        ASSERT_EQ(HookCalls, 1);
+
+        SetErrorHook(Previous);
+    }
+
+    TEST(ErrorHooks, ConstantEvaluation) {
+        constexpr Unexpected<int> Unex(42);
+        static_assert(Unex.Value() == 42);
+
+        constexpr Expected<int, int> Ex(unexpect, 7);
+        static_assert(Ex.Error() == 7);
+    }
+}
@@ -1,5 +1,7 @@
 #include <memory>
+#include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -264,11 +266,13 @@ namespace stdx::tests {
             ASSERT_EQ(Ex->Value, "world");
         }
 
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
         {
             Expected<ThrowableMoveConstructible, std::string> Ex(Unexpected("long long long string"));
             ASSERT_THROW(Ex = ThrowableMoveConstructible("world", true), std::logic_error);
             ASSERT_EQ(Ex.Error(), "long long long string");
         }
+#endif
     }
 
     TEST(Expected, Assign_Copy) {
@@ -308,12 +312,14 @@ namespace stdx::tests {
             ASSERT_EQ(Ex2, Ex1);
         }
 
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
         {
             Expected<ThrowableCopyConstructible, std::string> Ex1(std::in_place, "world", true);
             Expected<ThrowableCopyConstructible, std::string> Ex2 = Unexpected("long long long string");
             ASSERT_THROW(Ex2 = Ex1, std::logic_error);
             ASSERT_EQ(Ex2.Error(), "long long long string");
         }
+#endif
 
         {
             Expected<std::vector<int>, std::string> Ex1 = Unexpected("hello");
@@ -350,12 +356,14 @@ namespace stdx::tests {
             ASSERT_EQ(Ex2, Ex1);
         }
 
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
         {
             Expected<std::string, ThrowableCopyConstructible> Ex1(unexpect, "world", true);
             Expected<std::string, ThrowableCopyConstructible> Ex2 = "long long long string";
             ASSERT_THROW(Ex2 = Ex1, std::logic_error);
             ASSERT_EQ(*Ex2, "long long long string");
         }
+#endif
     }
 
     TEST(Expected, Assign_Move) {
@@ -389,12 +397,14 @@ namespace stdx::tests {
             ASSERT_EQ(Ex2->Value, "world");
         }
 
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
         {
             Expected<ThrowableMoveConstructible, std::string> Ex1(std::in_place, "world", true);
             Expected<ThrowableMoveConstructible, std::string> Ex2 = Unexpected("long long long string");
             ASSERT_THROW(Ex2 = std::move(Ex1), std::logic_error);
             ASSERT_EQ(Ex2.Error(), "long long long string");
         }
+#endif
 
         {
             Expected<std::vector<int>, std::string> Ex1 = Unexpected("hello");
@@ -424,12 +434,14 @@ namespace stdx::tests {
             ASSERT_EQ(Ex2.Error().Value, "world");
         }
 
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
         {
             Expected<std::string, ThrowableMoveConstructible> Ex1(unexpect, "world", true);
             Expected<std::string, ThrowableMoveConstructible> Ex2 = "long long long string";
             ASSERT_THROW(Ex2 = std::move(Ex1), std::logic_error);
             ASSERT_EQ(*Ex2, "long long long string");
         }
+#endif
     }
 
     TEST(Expected, Swap) {
@@ -497,6 +509,7 @@ namespace stdx::tests {
             ASSERT_EQ(Ex2.Value().Value, "hello");
         }
 
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
         {
             Expected<ThrowableMoveConstructible, std::string> Ex1(std::in_place, "long long long string", true);
             Expected<ThrowableMoveConstructible, std::string> Ex2 = Unexpected("hello beautiful world");
@@ -505,6 +518,7 @@ namespace stdx::tests {
             ASSERT_FALSE(Ex2.HasValue());
             ASSERT_EQ(Ex2.Error(), "hello beautiful world");
         }
+#endif
 
         {
             Expected<std::string, ThrowableMoveConstructible> Ex1 = "hello beautiful world";
@@ -515,6 +529,7 @@ namespace stdx::tests {
             ASSERT_EQ(Ex2.Value(), "hello beautiful world");
         }
 
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
         {
             Expected<std::string, ThrowableMoveConstructible> Ex1 = "hello beautiful world";
             Expected<std::string, ThrowableMoveConstructible> Ex2(unexpect, "long long long string", true);
@@ -523,6 +538,7 @@ namespace stdx::tests {
             ASSERT_FALSE(Ex2.HasValue());
             ASSERT_EQ(Ex2.Error().Value, "long long long string");
         }
+#endif
     }
 
     TEST(Expected, Emplace) {
@@ -556,11 +572,13 @@ namespace stdx::tests {
             ASSERT_TRUE(Ex.HasValue());
         }
 
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
         {
             Expected<ThrowableEmplaceConstructible, std::string> Ex = Unexpected("hello");
             ASSERT_THROW(Ex.Emplace(42, 78.0, "hello"), std::logic_error);
             ASSERT_EQ(Ex.Error(), "hello");
         }
+#endif
 
         {
             Expected<void, std::string> Ex;
@@ -646,6 +664,7 @@ namespace stdx::tests {
             ASSERT_EQ(std::move(Ex2).Error(), "hello");
         }
 
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
         {
             Expected<std::string, int> Ex1 = Unexpected(42);
             ASSERT_THROW(Ex1.Value(), BadExpectedAccess<int>);
@@ -654,7 +673,9 @@ namespace stdx::tests {
             ASSERT_THROW(Ex2.Value(), BadExpectedAccess<int>);
             ASSERT_THROW(std::move(Ex2).Value(), BadExpectedAccess<int>);
         }
+#endif
 
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
         {
             Expected<void, int> Ex1;
             ASSERT_NO_THROW(Ex1.Value());
@@ -663,7 +684,9 @@ namespace stdx::tests {
             ASSERT_NO_THROW(Ex2.Value());
             ASSERT_NO_THROW(std::move(Ex2).Value());
         }
+#endif
 
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
         {
             Expected<void, int> Ex1 = Unexpected(42);
             ASSERT_THROW(Ex1.Value(), BadExpectedAccess<int>);
@@ -673,6 +696,7 @@ namespace stdx::tests {
             ASSERT_THROW(Ex2.Value(), BadExpectedAccess<int>);
             ASSERT_THROW(std::move(Ex2).Value(), BadExpectedAccess<int>);
         }
+#endif
 
         {
             Expected<std::string, int> Ex1 = "hello";
@@ -712,4 +736,183 @@ namespace stdx::tests {
             ASSERT_EQ(std::move(Ex2).ValueOr("world"), "world");
         }
     }
-}
\ No newline at end of file
+
+    TEST(Expected, LazyFallbacks) {
+        int Made = 0;
+        const auto Fallback = [&Made] {
+            ++Made;
+            return std::string("world");
+        };
+
+        Expected<std::string, int> Ex = "hello";
+        ASSERT_EQ(Ex.ValueOrElse(Fallback), "hello");
+        ASSERT_EQ(Ex.ErrorOr(7), 7);
+        ASSERT_EQ(Ex.ErrorOrElse([] { return 8; }), 8);
+        ASSERT_EQ(Made, 0);
+
+        Ex = Unexpected(42);
+        ASSERT_EQ(Ex.ValueOrElse(Fallback), "world");
+        ASSERT_EQ(Ex.ValueOrElse([](int Error) { return std::to_string(Error); }), "42");
+        ASSERT_EQ(std::move(Ex).ValueOrElse(Fallback), "world");
+        ASSERT_EQ(Made, 2);
+        ASSERT_EQ(Ex.ErrorOr(7), 42);
+        ASSERT_EQ(Ex.ErrorOrElse([] { return 8; }), 42);
+
+        Expected<void, std::string> Void;
+        ASSERT_EQ(Void.ErrorOr("none"), "none");
+        Void = Unexpected("failed");
+        ASSERT_EQ(std::move(Void).ErrorOrElse([] { return "none"; }), "failed");
+    }
+
+    TEST(Expected, BorrowingAccessors) {
+        const std::string Fallback = "world";
+        Expected<std::string, int> Ex = "hello";
+        ASSERT_EQ(&Ex.ValueOrRef(Fallback), &*Ex);
+        ASSERT_EQ(Ex.ValueIf(), &*Ex);
+
+        std::string Mutable = "mutable";
+        Ex.ValueOrRef(Mutable) += "!";
+        ASSERT_EQ(*Ex, "hello!");
+
+        Ex = Unexpected(42);
+        ASSERT_EQ(&Ex.ValueOrRef(Fallback), &Fallback);
+        ASSERT_EQ(std::as_const(Ex).ValueIf(), nullptr);
+        Ex.ValueOrRef(Mutable) += "!";
+        ASSERT_EQ(Mutable, "mutable!");
+    }
+
+    TEST(Expected, AndThen) {
+        auto Parse = [](const std::string& Value) -> Expected<int, std::string> {
+            if (Value.empty()) {
+                return Unexpected("empty");
+            }
+            return int(size(Value));
+        };
+
+        {
+            Expected<std::string, std::string> Ex = "hello";
+            ASSERT_EQ(Ex.AndThen(Parse), 5);
+            ASSERT_EQ(std::move(Ex).AndThen(Parse), 5);
+        }
+
+        {
+            Expected<std::string, std::string> Ex = "";
+            ASSERT_EQ(Ex.AndThen(Parse).Error(), "empty");
+        }
+
+        {
+            const Expected<std::string, std::string> Ex = Unexpected("oops");
+            ASSERT_EQ(Ex.AndThen(Parse).Error(), "oops");
+        }
+
+        {
+            Expected<void, std::string> Ex;
+            auto Result = Ex.AndThen([]() -> Expected<int, std::string> { return 42; });
+            ASSERT_EQ(Result, 42);
+        }
+
+        {
+            Expected<std::unique_ptr<int>, std::string> Ex = std::make_unique<int>(42);
+            auto Result = std::move(Ex).AndThen([](std::unique_ptr<int>&& Ptr) -> Expected<int, std::string> { return *Ptr; });
+            ASSERT_EQ(Result, 42);
+        }
+    }
+
+    TEST(Expected, Transform) {
+        {
+            Expected<int, std::string> Ex = 21;
+            auto Result = Ex.Transform([](int Value) { return std::vector<int>(size_t(Value) * 2); });
+            ASSERT_EQ(size(*Result), 42);
+        }
+
+        {
+            Expected<int, std::string> Ex = Unexpected("hello");
+            auto Result = std::move(Ex).Transform([](int Value) { return Value * 2.0; });
+            static_assert(std::is_same_v<decltype(Result), Expected<double, std::string>>);
+            ASSERT_EQ(Result.Error(), "hello");
+        }
+
+        {
+            Expected<int, std::string> Ex = 42;
+            int Seen = 0;
+            auto Result = Ex.Transform([&](int Value) { Seen = Value; });
+            static_assert(std::is_same_v<decltype(Result), Expected<void, std::string>>);
+            ASSERT_TRUE(Result.HasValue());
+            ASSERT_EQ(Seen, 42);
+        }
+
+        {
+            const Expected<void, std::string> Ex = Unexpected("hello");
+            auto Result = Ex.Transform([] { return 42; });
+            ASSERT_EQ(Result.Error(), "hello");
+        }
+    }
+
+    TEST(Expected, OrElse) {
+        auto Recover = [](const std::string& Error) -> Expected<int, int> { return int(size(Error)); };
+
+        {
+            Expected<int, std::string> Ex = 42;
+            ASSERT_EQ(Ex.OrElse(Recover), 42);
+        }
+
+        {
+            Expected<int, std::string> Ex = Unexpected("hello");
+            ASSERT_EQ(Ex.OrElse(Recover), 5);
+        }
+
+        {
+            Expected<void, std::string> Ex = Unexpected("hello");
+            auto Result = std::move(Ex).OrElse([](std::string&& Error) -> Expected<void, std::size_t> {
+                return Unexpected(size(Error));
+            });
+            ASSERT_EQ(Result.Error(), 5);
+        }
+    }
+
+    TEST(Expected, TransformError) {
+        {
+            Expected<int, std::string> Ex = Unexpected("hello");
+            auto Result = Ex.TransformError([](const std::string& Error) { return size(Error); });
+            static_assert(std::is_same_v<decltype(Result), Expected<int, std::size_t>>);
+            ASSERT_EQ(Result.Error(), 5);
+        }
+
+        {
+            Expected<std::vector<int>, int> Ex(std::in_place, {1, 2, 3});
+            auto Result = std::move(Ex).TransformError([](int Error) { return std::to_string(Error); });
+            ASSERT_EQ(*Result, (std::vector<int>{1, 2, 3}));
+        }
+
+        {
+            Expected<void, int> Ex = Unexpected(42);
+            auto Result = Ex.TransformError([](int Error) { return std::to_string(Error); });
+            ASSERT_EQ(Result.Error(), "42");
+        }
+    }
+
+    TEST(Expected, Combinators_NoTemporaries) {
+        {
+            Counted::Reset();
+            Expected<int, Counted> Ex = 20;
+            auto Result = Ex.Transform([](int Value) { return Counted(Value + 1); })
+                              .Transform([](Counted&& Value) { return Counted(Value.Value * 2); })
+                              .AndThen([](Counted&& Value) { return Expected<Counted, Counted>(std::in_place, Value.Value); });
+            ASSERT_EQ(Result->Value, 42);
+            ASSERT_EQ(Counted::Copies, 0);
+            ASSERT_EQ(Counted::Moves, 0);
+        }
+
+        {
+            Counted::Reset();
+            Expected<int, Counted> Ex(unexpect, 42);
+            auto Result = std::move(Ex)
+                              .Transform([](int Value) { return Value + 1; })
+                              .AndThen([](int Value) -> Expected<long, Counted> { return Value; })
+                              .TransformError([](Counted&& Error) { return Counted(Error.Value + 1); });
+            ASSERT_EQ(Result.Error().Value, 43);
+            ASSERT_EQ(Counted::Copies, 0);
+            ASSERT_EQ(Counted::Moves, 2);
+        }
+    }
+}
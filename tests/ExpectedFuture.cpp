@@ -0,0 +1,248 @@
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Expected/ExpectedFuture.hpp>
+
+namespace stdx::tests {
+    enum class FutureError { Refused, Timeout };
+
+    // Counts the instances alive, to check that the slot destroys whatever result it still holds.
+    struct Alive {
+        explicit Alive(int Value) noexcept : Value(Value) {
+            ++Count;
+        }
+
+        Alive(const Alive& Other) noexcept : Value(Other.Value) {
+            ++Count;
+        }
+
+        ~Alive() {
+            --Count;
+        }
+
+        int Value;
+
+        static inline int Count = 0;
+    };
+
+    // Hands out blocks from std::allocator and counts those outstanding.
+    template <typename T>
+    struct CountingAllocator {
+        using value_type = T;
+
+        explicit CountingAllocator(int& Outstanding) noexcept : Outstanding(&Outstanding) {}
+
+        template <typename U>
+        CountingAllocator(const CountingAllocator<U>& Other) noexcept : Outstanding(Other.Outstanding) {}
+
+        T* allocate(std::size_t Count) {
+            ++*Outstanding;
+            return std::allocator<T>().allocate(Count);
+        }
+
+        void deallocate(T* Block, std::size_t Count) noexcept {
+            --*Outstanding;
+            std::allocator<T>().deallocate(Block, Count);
+        }
+
+        int* Outstanding;
+    };
+
+    TEST(ExpectedFuture, SetsValueAndError) {
+        ExpectedPromise<std::string, FutureError> Promise;
+        ExpectedFuture<std::string, FutureError> Future = Promise.GetFuture();
+        ASSERT_TRUE(Future.Valid());
+        ASSERT_FALSE(Future.IsReady());
+
+        Promise.SetValue(3, 'x');
+        ASSERT_FALSE(Promise.Valid());
+        ASSERT_TRUE(Future.IsReady());
+        ASSERT_EQ(Future.Get(), "xxx");
+        ASSERT_FALSE(Future.Valid());
+
+        ExpectedPromise<std::string, FutureError> Failing;
+        ExpectedFuture<std::string, FutureError> Failed = Failing.GetFuture();
+        Failing.SetError(FutureError::Timeout);
+        ASSERT_EQ(Failed.Get(), Unexpected(FutureError::Timeout));
+
+        ExpectedPromise<void, FutureError> Void;
+        ExpectedFuture<void, FutureError> VoidFuture = Void.GetFuture();
+        Void.SetValue();
+        ASSERT_TRUE(VoidFuture.Get().HasValue());
+    }
+
+    TEST(ExpectedFuture, SetsExpected) {
+        ExpectedPromise<int, FutureError> Promise;
+        ExpectedFuture<int, FutureError> Future = Promise.GetFuture();
+        const Expected<int, FutureError> Result = Unexpected(FutureError::Refused);
+        Promise.Set(Result);
+        ASSERT_EQ(Future.Get(), Result);
+
+        ExpectedPromise<void, FutureError> Void;
+        ExpectedFuture<void, FutureError> VoidFuture = Void.GetFuture();
+        Void.Set(Expected<void, FutureError>());
+        ASSERT_TRUE(VoidFuture.Get().HasValue());
+    }
+
+    TEST(ExpectedFuture, GetFutureOnce) {
+        ExpectedPromise<int, FutureError> Promise;
+        ExpectedFuture<int, FutureError> Future = Promise.GetFuture();
+        ASSERT_TRUE(Future.Valid());
+        ASSERT_FALSE(Promise.GetFuture().Valid());
+    }
+
+    TEST(ExpectedFuture, SetBeforeGetFuture) {
+        ExpectedPromise<std::string, FutureError> Promise;
+        Promise.SetValue("early");
+        ASSERT_FALSE(Promise.Valid());
+
+        ExpectedFuture<std::string, FutureError> Future = Promise.GetFuture();
+        ASSERT_TRUE(Future.Valid());
+        ASSERT_TRUE(Future.IsReady());
+        ASSERT_FALSE(Promise.GetFuture().Valid());
+        ASSERT_EQ(Future.Get(), "early");
+
+        ExpectedPromise<void, FutureError> Failed;
+        Failed.SetError(FutureError::Timeout);
+        ASSERT_EQ(Failed.GetFuture().Get(), Unexpected(FutureError::Timeout));
+    }
+
+    TEST(ExpectedFuture, SetTwice) {
+        ExpectedPromise<int, FutureError> Before;
+        Before.SetValue(1);
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
+        ASSERT_THROW(Before.SetValue(2), std::future_error);
+        ASSERT_THROW(Before.SetError(FutureError::Timeout), std::future_error);
+#else
+        ASSERT_DEATH(Before.SetValue(2), "");
+#endif
+        ASSERT_EQ(Before.GetFuture().Get(), 1);
+
+        ExpectedPromise<int, FutureError> After;
+        ExpectedFuture<int, FutureError> Future = After.GetFuture();
+        After.SetError(FutureError::Refused);
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
+        ASSERT_THROW(After.SetValue(2), std::future_error);
+        ASSERT_THROW(After.Set(Expected<int, FutureError>(3)), std::future_error);
+#else
+        ASSERT_DEATH(After.SetValue(2), "");
+#endif
+        ASSERT_EQ(Future.Get(), Unexpected(FutureError::Refused));
+
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
+        ExpectedPromise<int, FutureError> Moved = std::move(Before);
+        try {
+            Before.SetValue(4);
+            FAIL();
+        } catch (const std::future_error& Error) {
+            ASSERT_EQ(Error.code(), std::future_errc::no_state);
+        }
+#endif
+    }
+
+    TEST(ExpectedFuture, BrokenPromise) {
+        ExpectedFuture<int, FutureError> Future;
+        {
+            ExpectedPromise<int, FutureError> Promise;
+            Future = Promise.GetFuture();
+        }
+        ASSERT_TRUE(Future.IsReady());
+        ASSERT_TRUE(Future.WaitFor(std::chrono::seconds(0)));
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
+        ASSERT_THROW(static_cast<void>(Future.Get()), std::future_error);
+        ASSERT_FALSE(Future.Valid());
+#endif
+    }
+
+    TEST(ExpectedFuture, WaitForTimesOut) {
+        ExpectedPromise<int, FutureError> Promise;
+        ExpectedFuture<int, FutureError> Future = Promise.GetFuture();
+        ASSERT_FALSE(Future.WaitFor(std::chrono::milliseconds(1)));
+
+        Promise.SetValue(42);
+        ASSERT_TRUE(Future.WaitFor(std::chrono::milliseconds(1)));
+        ASSERT_EQ(Future.Get(), 42);
+    }
+
+    TEST(ExpectedFuture, ReleasesSlotWhicheverSideGoesLast) {
+        int Outstanding = 0;
+        const CountingAllocator<char> Alloc(Outstanding);
+        {
+            ExpectedPromise<Alive, FutureError> Promise(std::allocator_arg, Alloc);
+            ExpectedFuture<Alive, FutureError> Future = Promise.GetFuture();
+            Promise.SetValue(1);
+            ASSERT_EQ(Outstanding, 1);
+            ASSERT_EQ(Alive::Count, 1);
+        }
+        ASSERT_EQ(Outstanding, 0);
+        ASSERT_EQ(Alive::Count, 0);
+
+        {
+            ExpectedPromise<Alive, FutureError> Promise(std::allocator_arg, Alloc);
+            static_cast<void>(Promise.GetFuture());
+            Promise.SetValue(2);
+        }
+        ASSERT_EQ(Outstanding, 0);
+        ASSERT_EQ(Alive::Count, 0);
+
+        {
+            ExpectedPromise<Alive, FutureError> Promise(std::allocator_arg, Alloc);
+            Promise.SetValue(3);
+        }
+        ASSERT_EQ(Outstanding, 0);
+        ASSERT_EQ(Alive::Count, 0);
+
+        {
+            ExpectedPromise<Alive, FutureError> Promise(std::allocator_arg, Alloc);
+            Promise.SetValue(3);
+            ExpectedFuture<Alive, FutureError> Future = Promise.GetFuture();
+            ExpectedPromise<Alive, FutureError> Moved(std::move(Promise));
+            ASSERT_EQ(Outstanding, 1);
+        }
+        ASSERT_EQ(Outstanding, 0);
+        ASSERT_EQ(Alive::Count, 0);
+
+        {
+            ExpectedPromise<Alive, FutureError> Promise(std::allocator_arg, Alloc);
+            ExpectedFuture<Alive, FutureError> Future = Promise.GetFuture();
+            Promise.SetValue(4);
+            ASSERT_EQ(Future.Get()->Value, 4);
+            ASSERT_EQ(Outstanding, 0);
+        }
+        ASSERT_EQ(Alive::Count, 0);
+    }
+
+    TEST(ExpectedFuture, HandsOffAcrossThreads) {
+        constexpr int Rounds = 1000;
+        std::vector<ExpectedPromise<int, FutureError>> Promises(Rounds);
+        std::vector<ExpectedFuture<int, FutureError>> Futures;
+        for (ExpectedPromise<int, FutureError>& Promise : Promises) {
+            Futures.push_back(Promise.GetFuture());
+        }
+
+        std::thread Producer([&Promises] {
+            for (int I = 0; I < Rounds; ++I) {
+                if (I % 3 == 0) {
+                    Promises[std::size_t(I)].SetError(FutureError::Refused);
+                } else {
+                    Promises[std::size_t(I)].SetValue(I);
+                }
+            }
+        });
+        for (int I = 0; I < Rounds; ++I) {
+            const Expected<int, FutureError> Result = Futures[std::size_t(I)].Get();
+            if (I % 3 == 0) {
+                ASSERT_EQ(Result, Unexpected(FutureError::Refused));
+            } else {
+                ASSERT_EQ(Result, I);
+            }
+        }
+        Producer.join();
+    }
+}
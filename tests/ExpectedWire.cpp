@@ -0,0 +1,99 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include <Expected/ExpectedWire.hpp>
+
+namespace stdx::tests {
+    enum class WireStatus : std::uint16_t { Refused = 7, Timeout };
+
+    struct Response {
+        std::int64_t Id;
+        double Latency;
+        std::uint32_t Status;
+    };
+
+    struct alignas(16) Wide {
+        std::uint64_t Words[2];
+    };
+
+    using ResponseFormat = WireFormat<Response, WireStatus>;
+
+    TEST(ExpectedWire, Layout) {
+        static_assert(ResponseFormat::Alignment == alignof(Response));
+        static_assert(ResponseFormat::PayloadOffset == alignof(Response));
+        static_assert(ResponseFormat::Size == alignof(Response) + sizeof(Response));
+
+        static_assert(WireFormat<std::uint8_t, std::uint8_t>::Size == 2);
+        static_assert(WireFormat<void, std::uint32_t>::Size == 8);
+        static_assert(WireFormat<std::uint8_t, Wide>::Size == 32);
+        static_assert(WireFormat<std::uint64_t, std::uint8_t>::Size % alignof(std::uint64_t) == 0);
+
+        alignas(8) unsigned char Buffer[ResponseFormat::Size];
+        std::memset(Buffer, 0xAB, sizeof(Buffer));
+        ASSERT_EQ(WriteWire(Expected<Response, WireStatus>(unexpect, WireStatus::Timeout), Buffer, sizeof(Buffer)),
+                  ResponseFormat::Size);
+        ASSERT_EQ(Buffer[0], ResponseFormat::ErrorTag);
+        for (std::size_t I = 1; I < ResponseFormat::Size; ++I) {
+            if (I < ResponseFormat::PayloadOffset || I >= ResponseFormat::PayloadOffset + sizeof(WireStatus)) {
+                ASSERT_EQ(Buffer[I], 0) << I;
+            }
+        }
+    }
+
+    TEST(ExpectedWire, RoundTrip) {
+        alignas(8) unsigned char Buffer[2 * ResponseFormat::Size];
+        const Expected<Response, WireStatus> Ok = Response{42, 1.5, 200};
+        const Expected<Response, WireStatus> Failed = Unexpected(WireStatus::Refused);
+        ASSERT_EQ(WriteWire(Ok, Buffer, sizeof(Buffer)), ResponseFormat::Size);
+        ASSERT_EQ(WriteWire(Failed, Buffer + ResponseFormat::Size, ResponseFormat::Size), ResponseFormat::Size);
+
+        const auto First = ExpectedView<Response, WireStatus>::Read(Buffer, sizeof(Buffer));
+        ASSERT_TRUE(First.HasValue());
+        ASSERT_TRUE(First->HasValue());
+        ASSERT_EQ((*First)->Id, 42);
+        ASSERT_EQ(First->Value().Latency, 1.5);
+        ASSERT_EQ(static_cast<const void*>(&**First), static_cast<const void*>(Buffer + ResponseFormat::PayloadOffset));
+
+        const auto Second = ExpectedView<Response, WireStatus>::Read(Buffer + ResponseFormat::Size, ResponseFormat::Size);
+        ASSERT_TRUE(Second.HasValue());
+        ASSERT_FALSE(Second->HasValue());
+        ASSERT_EQ(Second->Error(), WireStatus::Refused);
+        ASSERT_EQ(Second->ValueOr(Response{0, 0, 500}).Status, 500u);
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
+        ASSERT_THROW(static_cast<void>(Second->Value()), BadExpectedAccess<WireStatus>);
+#endif
+
+        const Expected<Response, WireStatus> Loaded = First->Load();
+        ASSERT_EQ(Loaded->Id, 42);
+        ASSERT_EQ(Second->Load().Error(), Failed.Error());
+    }
+
+    TEST(ExpectedWire, RoundTripVoid) {
+        alignas(4) unsigned char Buffer[WireFormat<void, std::uint32_t>::Size];
+        ASSERT_TRUE(WriteWire(Expected<void, std::uint32_t>(), Buffer, sizeof(Buffer)).HasValue());
+        ASSERT_TRUE((ExpectedView<void, std::uint32_t>::Read(Buffer, sizeof(Buffer))->HasValue()));
+
+        ASSERT_TRUE(WriteWire(Expected<void, std::uint32_t>(unexpect, 5u), Buffer, sizeof(Buffer)).HasValue());
+        ASSERT_EQ((ExpectedView<void, std::uint32_t>::Read(Buffer, sizeof(Buffer))->Error()), 5u);
+    }
+
+    TEST(ExpectedWire, RejectsBadBuffers) {
+        alignas(8) unsigned char Buffer[ResponseFormat::Size + 8] = {};
+        const Expected<Response, WireStatus> Ok = Response{1, 2, 3};
+
+        ASSERT_EQ(WriteWire(Ok, Buffer, ResponseFormat::Size - 1), Unexpected(WireError::TooShort));
+        ASSERT_EQ(
+            (ExpectedView<Response, WireStatus>::Read(Buffer, ResponseFormat::Size)), Unexpected(WireError::BadTag));
+
+        ASSERT_TRUE(WriteWire(Ok, Buffer + 1, ResponseFormat::Size).HasValue());
+        ASSERT_EQ(
+            (ExpectedView<Response, WireStatus>::Read(Buffer + 1, ResponseFormat::Size)), Unexpected(WireError::Misaligned));
+
+        ASSERT_TRUE(WriteWire(Ok, Buffer, ResponseFormat::Size).HasValue());
+        ASSERT_EQ(
+            (ExpectedView<Response, WireStatus>::Read(Buffer, ResponseFormat::Size - 1)), Unexpected(WireError::TooShort));
+    }
+}
@@ -0,0 +1,88 @@
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::tests {
+    enum class IoError : std::int32_t { Timeout = 1, Refused };
+
+    struct Pair {
+        std::int64_t First;
+        std::int64_t Second;
+    };
+
+    struct MoveOnly {
+        MoveOnly(MoveOnly&&) = default;
+        MoveOnly& operator=(MoveOnly&&) = default;
+
+        int Value;
+    };
+
+    struct Immovable {
+        Immovable(Immovable&&) = delete;
+        Immovable& operator=(Immovable&&) = delete;
+    };
+
+    template <typename X>
+    constexpr bool ReturnsInRegisters() noexcept {
+        return std::is_trivially_copyable_v<X> && std::is_trivially_destructible_v<X> && sizeof(X) <= 2 * sizeof(void*);
+    }
+
+    static_assert(IsRegisterPassable<Expected<int, int>>());
+    static_assert(IsRegisterPassable<Expected<int, IoError>>());
+    static_assert(IsRegisterPassable<Expected<void, IoError>>());
+    static_assert(IsRegisterPassable<Expected<void, int>>());
+    static_assert(IsRegisterPassable<Expected<double, IoError>>());
+    static_assert(IsRegisterPassable<Expected<std::int64_t, std::int64_t>>());
+    static_assert(IsRegisterPassable<Expected<void*, IoError>>());
+    static_assert(IsRegisterPassable<Expected<MoveOnly, IoError>>());
+    static_assert(!std::is_copy_constructible_v<Expected<MoveOnly, IoError>>);
+    static_assert(std::is_trivially_move_constructible_v<Expected<MoveOnly, IoError>>);
+    static_assert(std::is_trivially_move_assignable_v<Expected<MoveOnly, IoError>>);
+
+    static_assert(ReturnsInRegisters<Expected<int, int>>());
+    static_assert(ReturnsInRegisters<Expected<void, IoError>>());
+    static_assert(ReturnsInRegisters<Expected<std::int64_t, std::int64_t>>());
+
+    static_assert(sizeof(Expected<int, int>) == 2 * sizeof(int));
+    static_assert(sizeof(Expected<void, IoError>) == 2 * sizeof(IoError));
+    static_assert(sizeof(Expected<std::int64_t, std::int64_t>) == 2 * sizeof(std::int64_t));
+
+    static_assert(!IsRegisterPassable<Expected<Pair, IoError>>());
+    static_assert(!IsRegisterPassable<Expected<std::array<char, 16>, IoError>>());
+    static_assert(!IsRegisterPassable<Expected<std::string, IoError>>());
+    static_assert(!IsRegisterPassable<Expected<int, std::string>>());
+    static_assert(!IsRegisterPassable<Expected<Immovable, IoError>>());
+    static_assert(!IsRegisterPassable<int>());
+
+    template <typename T, typename E>
+    [[gnu::noinline]] Expected<T, E> PassThrough(Expected<T, E> X) noexcept {
+        return X;
+    }
+
+    TEST(Layout, PassThrough) {
+        {
+            Expected<int, int> Ex = PassThrough(Expected<int, int>(42));
+            ASSERT_EQ(*Ex, 42);
+            Ex = PassThrough(Expected<int, int>(unexpect, 7));
+            ASSERT_EQ(Ex.Error(), 7);
+        }
+
+        {
+            Expected<void, IoError> Ex = PassThrough(Expected<void, IoError>());
+            ASSERT_TRUE(Ex.HasValue());
+            Ex = PassThrough(Expected<void, IoError>(unexpect, IoError::Refused));
+            ASSERT_EQ(Ex.Error(), IoError::Refused);
+        }
+
+        {
+            Expected<std::int64_t, std::int64_t> Ex = PassThrough(Expected<std::int64_t, std::int64_t>(-1));
+            ASSERT_EQ(*Ex, -1);
+            Ex = PassThrough(Expected<std::int64_t, std::int64_t>(unexpect, INT64_MIN));
+            ASSERT_EQ(Ex.Error(), INT64_MIN);
+        }
+    }
+}
@@ -0,0 +1,139 @@
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Expected/MemoCache.hpp>
+
+namespace stdx::tests {
+    enum class ResolveError { NotFound, Timeout };
+
+    using Cache = MemoCache<int, std::string, ResolveError>;
+
+    // Resolves even keys and fails odd ones, counting how many times it actually ran.
+    struct Resolver {
+        Expected<std::string, ResolveError> operator()(int Key) {
+            ++Calls;
+            if (Key % 2 != 0) {
+                return Unexpected(ResolveError::NotFound);
+            }
+            return std::to_string(Key);
+        }
+
+        int Calls = 0;
+    };
+
+    TEST(MemoCache, CachesValuesAndErrors) {
+        Cache Memo(8, 8);
+        Resolver Resolve;
+
+        ASSERT_EQ(Memo.GetOrCompute(2, std::ref(Resolve)), "2");
+        ASSERT_EQ(Memo.GetOrCompute(2, std::ref(Resolve)), "2");
+        ASSERT_EQ(Resolve.Calls, 1);
+
+        ASSERT_EQ(Memo.GetOrCompute(3, std::ref(Resolve)), Unexpected(ResolveError::NotFound));
+        ASSERT_EQ(Memo.GetOrCompute(3, std::ref(Resolve)), Unexpected(ResolveError::NotFound));
+        ASSERT_EQ(Resolve.Calls, 2);
+
+        ASSERT_EQ(Memo.CountValues(), 1u);
+        ASSERT_EQ(Memo.CountErrors(), 1u);
+    }
+
+    TEST(MemoCache, ErrorStormKeepsValues) {
+        Cache Memo(4, 2, 1);
+        Resolver Resolve;
+
+        for (int Key = 0; Key < 8; Key += 2) {
+            static_cast<void>(Memo.GetOrCompute(Key, std::ref(Resolve)));
+        }
+        for (int Key = 1; Key < 1000; Key += 2) {
+            static_cast<void>(Memo.GetOrCompute(Key, std::ref(Resolve)));
+        }
+        ASSERT_EQ(Memo.CountValues(), 4u);
+        ASSERT_EQ(Memo.CountErrors(), 2u);
+
+        const int Calls = Resolve.Calls;
+        for (int Key = 0; Key < 8; Key += 2) {
+            ASSERT_EQ(Memo.GetOrCompute(Key, std::ref(Resolve)), std::to_string(Key));
+        }
+        ASSERT_EQ(Resolve.Calls, Calls);
+    }
+
+    TEST(MemoCache, EvictsLeastRecentlyUsed) {
+        Cache Memo(2, 2, 1);
+        Memo.Insert(0, std::string("zero"));
+        Memo.Insert(2, std::string("two"));
+        ASSERT_TRUE(Memo.Find(0).has_value());
+
+        Memo.Insert(4, std::string("four"));
+        ASSERT_TRUE(Memo.Find(0).has_value());
+        ASSERT_FALSE(Memo.Find(2).has_value());
+        ASSERT_TRUE(Memo.Find(4).has_value());
+    }
+
+    TEST(MemoCache, ReplacesAcrossKinds) {
+        Cache Memo(2, 2, 1);
+        Memo.Insert(1, Unexpected(ResolveError::Timeout));
+        ASSERT_EQ(Memo.CountErrors(), 1u);
+
+        Memo.Insert(1, std::string("one"));
+        ASSERT_EQ(Memo.CountErrors(), 0u);
+        ASSERT_EQ(Memo.CountValues(), 1u);
+        ASSERT_EQ(*Memo.Find(1), "one");
+
+        ASSERT_TRUE(Memo.Erase(1));
+        ASSERT_FALSE(Memo.Erase(1));
+        ASSERT_FALSE(Memo.Find(1).has_value());
+
+        Memo.Insert(2, std::string("two"));
+        Memo.Clear();
+        ASSERT_EQ(Memo.CountValues(), 0u);
+    }
+
+    TEST(MemoCache, NegativeCachingDisabled) {
+        Cache Memo(2, 0, 1);
+        Resolver Resolve;
+
+        static_cast<void>(Memo.GetOrCompute(1, std::ref(Resolve)));
+        static_cast<void>(Memo.GetOrCompute(1, std::ref(Resolve)));
+        ASSERT_EQ(Resolve.Calls, 2);
+        ASSERT_EQ(Memo.CountErrors(), 0u);
+    }
+
+    TEST(MemoCache, Concurrent) {
+        Cache Memo(256, 256, 4);
+        std::atomic<int> Calls = 0;
+        auto Resolve = [&](int Key) -> Expected<std::string, ResolveError> {
+            ++Calls;
+            if (Key % 2 != 0) {
+                return Unexpected(ResolveError::NotFound);
+            }
+            return std::to_string(Key);
+        };
+
+        std::vector<std::thread> Threads;
+        std::atomic<int> Mismatches = 0;
+        for (int I = 0; I < 8; ++I) {
+            Threads.emplace_back([&] {
+                for (int Round = 0; Round < 100; ++Round) {
+                    for (int Key = 0; Key < 64; ++Key) {
+                        const auto Result = Memo.GetOrCompute(Key, Resolve);
+                        if (Result.HasValue() != (Key % 2 == 0)) {
+                            ++Mismatches;
+                        }
+                    }
+                }
+            });
+        }
+        for (std::thread& Thread : Threads) {
+            Thread.join();
+        }
+
+        ASSERT_EQ(Mismatches.load(), 0);
+        ASSERT_EQ(Memo.CountValues(), 32u);
+        ASSERT_EQ(Memo.CountErrors(), 32u);
+        ASSERT_LE(Calls.load(), 8 * 64);
+    }
+}
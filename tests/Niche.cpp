@@ -0,0 +1,142 @@
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::tests {
+    enum class ErrCode : std::uint8_t { Timeout, Refused, Reset };
+
+    struct Handle {
+        std::uint16_t Slot;
+        std::uint8_t Generation;
+        std::uint8_t Kind;
+    };
+
+    bool operator==(const Handle& A, const Handle& B) noexcept {
+        return A.Slot == B.Slot && A.Generation == B.Generation && A.Kind == B.Kind;
+    }
+
+    struct Status {
+        std::uint16_t Code;
+        std::uint8_t Domain;
+        std::uint8_t Severity;
+    };
+
+    bool operator==(const Status& A, const Status& B) noexcept {
+        return A.Code == B.Code && A.Domain == B.Domain && A.Severity == B.Severity;
+    }
+}
+
+template <>
+struct stdx::NicheTraits<stdx::tests::ErrCode> {
+    static constexpr std::size_t Offset = 0;
+    static constexpr unsigned char Value = 0xFF;
+};
+
+template <>
+struct stdx::NicheTraits<stdx::tests::Handle> {
+    static constexpr std::size_t Offset = offsetof(stdx::tests::Handle, Kind);
+    static constexpr unsigned char Value = 0xFF;
+};
+
+template <>
+struct stdx::NicheTraits<stdx::tests::Status> {
+    static constexpr std::size_t Offset = offsetof(stdx::tests::Status, Severity);
+    static constexpr unsigned char Value = 0xFF;
+};
+
+namespace stdx::tests {
+    using details::ENichePlacement;
+    using details::SelectNichePlacement;
+
+    static_assert(SelectNichePlacement<void, ErrCode>() == ENichePlacement::InError);
+    static_assert(SelectNichePlacement<Handle, ErrCode>() == ENichePlacement::InValue);
+    static_assert(SelectNichePlacement<std::uint16_t, Status>() == ENichePlacement::InError);
+    static_assert(SelectNichePlacement<Handle, Status>() == ENichePlacement::None);
+    static_assert(SelectNichePlacement<int, double>() == ENichePlacement::None);
+
+    static_assert(sizeof(Expected<void, ErrCode>) == sizeof(ErrCode));
+    static_assert(sizeof(Expected<Handle, ErrCode>) == sizeof(Handle));
+    static_assert(sizeof(Expected<Handle, std::uint8_t>) == sizeof(Handle));
+    static_assert(sizeof(Expected<std::uint16_t, Status>) == sizeof(Status));
+    static_assert(sizeof(Expected<Handle, Status>) > sizeof(Handle));
+    static_assert(std::is_trivially_copyable_v<Expected<void, ErrCode>>);
+    static_assert(std::is_trivially_copyable_v<Expected<Handle, ErrCode>>);
+
+    TEST(Niche, InError_Void) {
+        Expected<void, ErrCode> Ex1;
+        ASSERT_TRUE(Ex1.HasValue());
+
+        Expected<void, ErrCode> Ex2 = Unexpected(ErrCode::Refused);
+        ASSERT_FALSE(Ex2.HasValue());
+        ASSERT_EQ(Ex2.Error(), ErrCode::Refused);
+
+        Ex1 = Ex2;
+        ASSERT_FALSE(Ex1.HasValue());
+        ASSERT_EQ(Ex1.Error(), ErrCode::Refused);
+
+        Ex1.Emplace();
+        ASSERT_TRUE(Ex1.HasValue());
+
+        Ex1.Swap(Ex2);
+        ASSERT_FALSE(Ex1.HasValue());
+        ASSERT_TRUE(Ex2.HasValue());
+        ASSERT_EQ(Ex1.Error(), ErrCode::Refused);
+
+        Ex2 = Unexpected(ErrCode::Reset);
+        ASSERT_EQ(Ex2.Error(), ErrCode::Reset);
+    }
+
+    TEST(Niche, InValue) {
+        Expected<Handle, ErrCode> Ex1 = Handle{42, 1, 0};
+        ASSERT_TRUE(Ex1.HasValue());
+        ASSERT_EQ(Ex1->Slot, 42);
+
+        Expected<Handle, ErrCode> Ex2(unexpect, ErrCode::Timeout);
+        ASSERT_FALSE(Ex2.HasValue());
+        ASSERT_EQ(Ex2.Error(), ErrCode::Timeout);
+
+        Ex1.Swap(Ex2);
+        ASSERT_FALSE(Ex1.HasValue());
+        ASSERT_EQ(Ex1.Error(), ErrCode::Timeout);
+        ASSERT_EQ(*Ex2, (Handle{42, 1, 0}));
+
+        Ex1 = Handle{7, 2, 3};
+        ASSERT_TRUE(Ex1.HasValue());
+        ASSERT_EQ(*Ex1, (Handle{7, 2, 3}));
+
+        Ex1 = Unexpected(ErrCode::Reset);
+        ASSERT_FALSE(Ex1.HasValue());
+        ASSERT_EQ(Ex1.Error(), ErrCode::Reset);
+
+        Ex1.Emplace(Handle{1, 1, 1});
+        ASSERT_EQ(*Ex1, (Handle{1, 1, 1}));
+
+        Expected<Handle, ErrCode> Ex3 = Ex2;
+        ASSERT_EQ(Ex3, Ex2);
+    }
+
+    TEST(Niche, InError) {
+        Expected<std::uint16_t, Status> Ex1 = std::uint16_t(42);
+        ASSERT_TRUE(Ex1.HasValue());
+        ASSERT_EQ(*Ex1, 42);
+
+        Expected<std::uint16_t, Status> Ex2 = Unexpected(Status{404, 1, 2});
+        ASSERT_FALSE(Ex2.HasValue());
+        ASSERT_EQ(Ex2.Error(), (Status{404, 1, 2}));
+
+        Ex1 = Ex2;
+        ASSERT_FALSE(Ex1.HasValue());
+        ASSERT_EQ(Ex1, Ex2);
+
+        Ex1.Emplace(std::uint16_t(7));
+        ASSERT_TRUE(Ex1.HasValue());
+        ASSERT_EQ(*Ex1, 7);
+
+        Ex1.Swap(Ex2);
+        ASSERT_FALSE(Ex1.HasValue());
+        ASSERT_EQ(*Ex2, 7);
+    }
+}
@@ -0,0 +1,63 @@
+#include <cstdio>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Expected/Expected.hpp>
+
+#include "Utility.hpp"
+
+namespace stdx::tests {
+    static_assert(!details::ExceptionsEnabled(), "this file must be compiled with exceptions disabled");
+
+    TEST(NoExceptions, Value_Aborts) {
+        Expected<std::string, int> Ex1 = Unexpected(42);
+        ASSERT_DEATH(static_cast<void>(Ex1.Value()), "");
+        ASSERT_DEATH(static_cast<void>(std::move(Ex1).Value()), "");
+
+        Expected<void, int> Ex2 = Unexpected(42);
+        ASSERT_DEATH(Ex2.Value(), "");
+    }
+
+    TEST(NoExceptions, Value_CallsHandler) {
+        BadExpectedAccessHandler Previous = SetBadExpectedAccessHandler([] {
+            std::fputs("bad access handler", stderr);
+        });
+        ASSERT_EQ(Previous, nullptr);
+
+        const Expected<int, std::string> Ex = Unexpected("hello");
+        ASSERT_DEATH(static_cast<void>(Ex.Value()), "bad access handler");
+
+        SetBadExpectedAccessHandler(Previous);
+    }
+
+    TEST(NoExceptions, Assign_Direct) {
+        {
+            Expected<ThrowableMoveConstructible, std::string> Ex(Unexpected("hello"));
+            Ex = ThrowableMoveConstructible("world", false);
+            ASSERT_EQ(Ex->Value, "world");
+        }
+
+        {
+            Expected<ThrowableCopyConstructible, std::string> Ex1(std::in_place, "world", false);
+            Expected<ThrowableCopyConstructible, std::string> Ex2 = Unexpected("hello");
+            Ex2 = Ex1;
+            ASSERT_EQ(Ex2, Ex1);
+        }
+
+        {
+            Expected<std::string, ThrowableMoveConstructible> Ex1(unexpect, "world", false);
+            Expected<std::string, ThrowableMoveConstructible> Ex2 = "hello";
+            Ex2 = std::move(Ex1);
+            ASSERT_EQ(Ex2.Error().Value, "world");
+        }
+
+        {
+            Expected<ThrowableMoveConstructible, std::string> Ex1(std::in_place, "hello", false);
+            Expected<ThrowableMoveConstructible, std::string> Ex2 = Unexpected("world");
+            swap(Ex1, Ex2);
+            ASSERT_EQ(Ex1.Error(), "world");
+            ASSERT_EQ(Ex2->Value, "hello");
+        }
+    }
+}
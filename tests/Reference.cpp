@@ -0,0 +1,182 @@
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::tests {
+    struct Record {
+        std::string Name;
+        int Size;
+
+        friend bool operator==(const Record& X, const Record& Y) noexcept {
+            return X.Name == Y.Name && X.Size == Y.Size;
+        }
+
+        friend bool operator!=(const Record& X, const Record& Y) noexcept {
+            return !(X == Y);
+        }
+    };
+
+    struct DerivedRecord : Record {};
+
+    enum class LookupError { Missing, Expired };
+
+    using RecordRef = Expected<Record&, LookupError>;
+    using ConstRecordRef = Expected<const Record&, LookupError>;
+
+    static_assert(sizeof(RecordRef) == sizeof(Expected<Record*, LookupError>));
+    static_assert(std::is_trivially_copyable_v<RecordRef>);
+    static_assert(IsRegisterPassable<RecordRef>());
+    static_assert(std::is_same_v<RecordRef::ValueType, Record&>);
+
+    // Temporaries are never bound to.
+    static_assert(std::is_constructible_v<RecordRef, Record&>);
+    static_assert(std::is_constructible_v<RecordRef, DerivedRecord&>);
+    static_assert(!std::is_constructible_v<RecordRef, Record&&>);
+    static_assert(!std::is_constructible_v<RecordRef, const Record&>);
+    static_assert(!std::is_constructible_v<ConstRecordRef, const Record&&>);
+    static_assert(!std::is_assignable_v<RecordRef&, Record>);
+    static_assert(!std::is_default_constructible_v<RecordRef>);
+
+    static_assert(std::is_convertible_v<const RecordRef&, ConstRecordRef>);
+    static_assert(!std::is_convertible_v<const ConstRecordRef&, RecordRef>);
+
+    TEST(Reference, BindsWithoutCopying) {
+        Record R{"first", 1};
+        RecordRef Ex = R;
+        ASSERT_TRUE(Ex.HasValue());
+        ASSERT_EQ(&*Ex, &R);
+        ASSERT_EQ(&Ex.Value(), &R);
+
+        Ex->Size = 2;
+        ASSERT_EQ(R.Size, 2);
+
+        const RecordRef Copy = Ex;
+        Copy->Size = 3;
+        ASSERT_EQ(R.Size, 3);
+
+        ConstRecordRef Const = Copy;
+        ASSERT_EQ(&*Const, &R);
+
+        DerivedRecord D;
+        RecordRef Base(std::in_place, D);
+        ASSERT_EQ(&*Base, static_cast<Record*>(&D));
+    }
+
+    TEST(Reference, AssignmentRebinds) {
+        Record First{"first", 1};
+        Record Second{"second", 2};
+
+        RecordRef Ex = First;
+        Ex = Second;
+        ASSERT_EQ(&*Ex, &Second);
+        ASSERT_EQ(First.Name, "first");
+
+        Ex = Unexpected(LookupError::Missing);
+        ASSERT_EQ(Ex.Error(), LookupError::Missing);
+        Ex = Unexpected(LookupError::Expired);
+        ASSERT_EQ(Ex.Error(), LookupError::Expired);
+
+        ASSERT_EQ(&Ex.Emplace(First), &First);
+        ASSERT_EQ(&*Ex, &First);
+
+        RecordRef Other = Second;
+        Ex = Other;
+        ASSERT_EQ(&*Ex, &Second);
+        ASSERT_EQ(First.Name, "first");
+    }
+
+    TEST(Reference, ErrorCarryingReference) {
+        Expected<const Record&, std::string> Ex(unexpect, "missing");
+        ASSERT_FALSE(Ex.HasValue());
+        ASSERT_EQ(Ex.Error(), "missing");
+        ASSERT_EQ(Ex.ValueOr(Record{"fallback", 0}).Name, "fallback");
+
+        const Record R{"found", 1};
+        Ex = R;
+        ASSERT_EQ(Ex.ValueOr(Record{"fallback", 0}).Name, "found");
+        ASSERT_EQ(Ex.ValueOrElse([] { return Record{"fallback", 0}; }).Name, "found");
+        ASSERT_EQ(Ex.ValueIf(), &R);
+
+        const Record Fallback{"fallback", 0};
+        ASSERT_EQ(&Ex.ValueOrRef(Fallback), &R);
+
+        Ex = Unexpected<std::string>("expired");
+        ASSERT_EQ(Ex.Error(), "expired");
+        ASSERT_EQ(&Ex.ValueOrRef(Fallback), &Fallback);
+        ASSERT_EQ(Ex.ValueIf(), nullptr);
+        ASSERT_EQ(Ex.ValueOrElse([](const std::string& Error) { return Record{Error, 0}; }).Name, "expired");
+
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
+        ASSERT_THROW(static_cast<void>(Ex.Value()), BadExpectedAccess<std::string>);
+#endif
+    }
+
+    TEST(Reference, Comparison) {
+        Record First{"same", 1};
+        Record Second{"same", 1};
+
+        RecordRef X = First;
+        RecordRef Y = Second;
+        RecordRef Error = Unexpected(LookupError::Missing);
+
+        ASSERT_EQ(X, Y);
+        ASSERT_EQ(X, Second);
+        ASSERT_NE(X, Error);
+        ASSERT_EQ(Error, Unexpected(LookupError::Missing));
+
+        Second.Size = 2;
+        ASSERT_NE(X, Y);
+    }
+
+    TEST(Reference, Swap) {
+        Record First{"first", 1};
+        Record Second{"second", 2};
+
+        RecordRef X = First;
+        RecordRef Y = Second;
+        swap(X, Y);
+        ASSERT_EQ(&*X, &Second);
+        ASSERT_EQ(&*Y, &First);
+
+        Expected<Record&, std::string> Value = First;
+        Expected<Record&, std::string> Error(unexpect, "missing");
+        Value.Swap(Error);
+        ASSERT_EQ(Value.Error(), "missing");
+        ASSERT_EQ(&*Error, &First);
+        Value.Swap(Error);
+        ASSERT_EQ(&*Value, &First);
+        ASSERT_EQ(Error.Error(), "missing");
+    }
+
+    TEST(Reference, Combinators) {
+        Record R{"record", 4};
+        RecordRef Ex = R;
+
+        auto Name = Ex.Transform([](Record& X) -> std::string& { return X.Name; });
+        static_assert(std::is_same_v<decltype(Name), Expected<std::string&, LookupError>>);
+        ASSERT_EQ(&*Name, &R.Name);
+
+        auto Size = Ex.Transform([](const Record& X) { return X.Size; });
+        static_assert(std::is_same_v<decltype(Size), Expected<int, LookupError>>);
+        ASSERT_EQ(*Size, 4);
+
+        auto Same = Ex.AndThen([](Record& X) -> RecordRef { return X; });
+        ASSERT_EQ(&*Same, &R);
+
+        RecordRef Missing = Unexpected(LookupError::Missing);
+        Record Fallback{"fallback", 0};
+        auto Recovered = Missing.OrElse([&](LookupError) -> RecordRef { return Fallback; });
+        ASSERT_EQ(&*Recovered, &Fallback);
+
+        auto Described = Missing.TransformError([](LookupError) { return std::string("missing"); });
+        static_assert(std::is_same_v<decltype(Described), Expected<Record&, std::string>>);
+        ASSERT_EQ(Described.Error(), "missing");
+
+        auto Kept = Ex.TransformError([](LookupError) { return 0; });
+        ASSERT_EQ(&*Kept, &R);
+    }
+}
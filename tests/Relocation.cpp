@@ -0,0 +1,122 @@
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::tests {
+    enum class RelocationError { Lost, Stale };
+
+    // Owns a heap block and never points into itself, but is not trivially copyable: it has to opt in.
+    struct Handle {
+        explicit Handle(int Value) : Block(new int(Value)) {}
+
+        Handle(Handle&& Other) noexcept : Block(std::exchange(Other.Block, nullptr)) {}
+
+        Handle& operator=(Handle&& Other) noexcept {
+            std::swap(Block, Other.Block);
+            return *this;
+        }
+
+        ~Handle() {
+            delete Block;
+        }
+
+        int* Block;
+    };
+}
+
+template <>
+struct stdx::IsTriviallyRelocatable<stdx::tests::Handle> : std::true_type {};
+
+namespace stdx::tests {
+    static_assert(IsTriviallyRelocatable<Expected<std::unique_ptr<int>, RelocationError>>());
+    static_assert(IsTriviallyRelocatable<Expected<void, std::unique_ptr<int>>>());
+    static_assert(IsTriviallyRelocatable<Expected<int&, Handle>>());
+    static_assert(IsTriviallyRelocatable<Expected<Handle, int>>());
+    static_assert(!IsTriviallyRelocatable<Expected<std::unique_ptr<int>, std::string>>());
+    static_assert(!IsTriviallyRelocatable<Expected<std::string, int>>());
+
+    TEST(Relocation, SwapsAsBytes) {
+        using Ex = Expected<std::unique_ptr<int>, Handle>;
+
+        Ex A(std::make_unique<int>(1));
+        Ex B(unexpect, 2);
+        Ex C(std::make_unique<int>(3));
+
+        A.Swap(B);
+        ASSERT_FALSE(A.HasValue());
+        ASSERT_EQ(*A.Error().Block, 2);
+        ASSERT_EQ(**B, 1);
+
+        swap(B, C);
+        ASSERT_EQ(**B, 3);
+        ASSERT_EQ(**C, 1);
+
+        Ex D(unexpect, 4);
+        A.Swap(D);
+        ASSERT_EQ(*A.Error().Block, 4);
+        ASSERT_EQ(*D.Error().Block, 2);
+
+        swap(C, C);
+        ASSERT_EQ(**C, 1);
+    }
+
+    TEST(Relocation, SwapsReferences) {
+        int X = 1;
+        int Y = 2;
+        Expected<int&, Handle> A(X);
+        Expected<int&, Handle> B(unexpect, 5);
+        Expected<int&, Handle> C(Y);
+
+        A.Swap(B);
+        ASSERT_EQ(*A.Error().Block, 5);
+        ASSERT_EQ(&*B, &X);
+
+        B.Swap(C);
+        ASSERT_EQ(&*B, &Y);
+        ASSERT_EQ(&*C, &X);
+    }
+
+    template <typename X>
+    struct RawStorage {
+        ~RawStorage() {
+            for (std::size_t I = 0; I < Count; ++I) {
+                std::launder(reinterpret_cast<X*>(Bytes))[I].~X();
+            }
+        }
+
+        X* Data() noexcept {
+            return std::launder(reinterpret_cast<X*>(Bytes));
+        }
+
+        alignas(X) unsigned char Bytes[4 * sizeof(X)];
+        std::size_t Count = 0;
+    };
+
+    TEST(Relocation, UninitializedRelocate) {
+        using Ex = Expected<std::unique_ptr<int>, Handle>;
+
+        RawStorage<Ex> From;
+        ::new (static_cast<void*>(From.Data())) Ex(std::make_unique<int>(7));
+        ::new (static_cast<void*>(From.Data() + 1)) Ex(unexpect, 8);
+
+        RawStorage<Ex> To;
+        ASSERT_EQ(UninitializedRelocate(From.Data(), From.Data() + 2, To.Data()), To.Data() + 2);
+        To.Count = 2;
+        ASSERT_EQ(**To.Data()[0], 7);
+        ASSERT_EQ(*To.Data()[1].Error().Block, 8);
+
+        // Objects that do not opt in are moved and destroyed.
+        RawStorage<Expected<std::string, int>> Strings;
+        ::new (static_cast<void*>(Strings.Data())) Expected<std::string, int>(std::string(40, 's'));
+        RawStorage<Expected<std::string, int>> Moved;
+        UninitializedRelocate(Strings.Data(), Strings.Data() + 1, Moved.Data());
+        Moved.Count = 1;
+        ASSERT_EQ(*Moved.Data()[0], std::string(40, 's'));
+    }
+}
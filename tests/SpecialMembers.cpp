@@ -0,0 +1,124 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include <Expected/Expected.hpp>
+
+namespace stdx::tests {
+    // Built both as C++17, where the special members come from a chain of layers, and as C++20, where they are
+    // selected by constraints. Each property of Expected<T, E> must follow from T and E the same way in both.
+    struct TrivialCopyNonTrivialDestructor {
+        ~TrivialCopyNonTrivialDestructor() {}
+
+        int Value;
+    };
+
+    struct MoveOnlyNonTrivial {
+        MoveOnlyNonTrivial(MoveOnlyNonTrivial&&) noexcept {}
+        MoveOnlyNonTrivial& operator=(MoveOnlyNonTrivial&&) noexcept {
+            return *this;
+        }
+    };
+
+    struct ThrowingMove {
+        ThrowingMove(const ThrowingMove&) {}
+        ThrowingMove(ThrowingMove&&) {}
+        ThrowingMove& operator=(const ThrowingMove&) {
+            return *this;
+        }
+        ThrowingMove& operator=(ThrowingMove&&) {
+            return *this;
+        }
+    };
+
+    struct NonAssignable {
+        NonAssignable(const NonAssignable&) = default;
+        NonAssignable& operator=(const NonAssignable&) = delete;
+    };
+
+    template <typename X>
+    struct Properties {
+        static constexpr bool bTriviallyDestructible = std::is_trivially_destructible_v<X>;
+        static constexpr bool bCopyConstructible = std::is_copy_constructible_v<X>;
+        static constexpr bool bTriviallyCopyConstructible = std::is_trivially_copy_constructible_v<X>;
+        static constexpr bool bMoveConstructible = std::is_move_constructible_v<X>;
+        static constexpr bool bTriviallyMoveConstructible = std::is_trivially_move_constructible_v<X>;
+        static constexpr bool bCopyAssignable = std::is_copy_assignable_v<X>;
+        static constexpr bool bTriviallyCopyAssignable = std::is_trivially_copy_assignable_v<X>;
+        static constexpr bool bMoveAssignable = std::is_move_assignable_v<X>;
+        static constexpr bool bTriviallyMoveAssignable = std::is_trivially_move_assignable_v<X>;
+        static constexpr bool bNothrowMoveConstructible = std::is_nothrow_move_constructible_v<X>;
+        static constexpr bool bNothrowMoveAssignable = std::is_nothrow_move_assignable_v<X>;
+    };
+
+    template <typename T, typename E>
+    constexpr bool FollowsAlternatives() noexcept {
+        using X = Properties<Expected<T, E>>;
+        using A = Properties<T>;
+        using B = Properties<E>;
+
+        const bool bNothrowBackup = A::bNothrowMoveConstructible || B::bNothrowMoveConstructible;
+        return X::bTriviallyDestructible == (A::bTriviallyDestructible && B::bTriviallyDestructible) &&
+               X::bCopyConstructible == (A::bCopyConstructible && B::bCopyConstructible) &&
+               X::bTriviallyCopyConstructible == (A::bTriviallyCopyConstructible && B::bTriviallyCopyConstructible) &&
+               X::bMoveConstructible == (A::bMoveConstructible && B::bMoveConstructible) &&
+               X::bTriviallyMoveConstructible == (A::bTriviallyMoveConstructible && B::bTriviallyMoveConstructible) &&
+               X::bCopyAssignable == (A::bCopyConstructible && A::bMoveAssignable && B::bCopyConstructible &&
+                                      B::bMoveAssignable && bNothrowBackup) &&
+               X::bTriviallyCopyAssignable == (X::bCopyAssignable && X::bTriviallyCopyConstructible &&
+                                               X::bTriviallyDestructible && A::bTriviallyCopyAssignable &&
+                                               B::bTriviallyCopyAssignable) &&
+               X::bMoveAssignable == (A::bMoveConstructible && A::bMoveAssignable && B::bMoveConstructible &&
+                                      B::bMoveAssignable && bNothrowBackup) &&
+               X::bTriviallyMoveAssignable == (X::bMoveAssignable && X::bTriviallyMoveConstructible &&
+                                               X::bTriviallyDestructible && A::bTriviallyMoveAssignable &&
+                                               B::bTriviallyMoveAssignable) &&
+               X::bNothrowMoveConstructible == (A::bNothrowMoveConstructible && B::bNothrowMoveConstructible) &&
+               X::bNothrowMoveAssignable == (X::bMoveAssignable && A::bNothrowMoveConstructible &&
+                                             A::bNothrowMoveAssignable && B::bNothrowMoveConstructible &&
+                                             B::bNothrowMoveAssignable);
+    }
+
+    static_assert(FollowsAlternatives<int, int>());
+    static_assert(FollowsAlternatives<int, std::string>());
+    static_assert(FollowsAlternatives<std::string, int>());
+    static_assert(FollowsAlternatives<std::string, std::string>());
+    static_assert(FollowsAlternatives<std::unique_ptr<int>, int>());
+    static_assert(FollowsAlternatives<TrivialCopyNonTrivialDestructor, int>());
+    static_assert(FollowsAlternatives<int, TrivialCopyNonTrivialDestructor>());
+    static_assert(FollowsAlternatives<MoveOnlyNonTrivial, int>());
+    static_assert(FollowsAlternatives<MoveOnlyNonTrivial, std::string>());
+    static_assert(FollowsAlternatives<ThrowingMove, int>());
+    static_assert(FollowsAlternatives<ThrowingMove, ThrowingMove>());
+    static_assert(FollowsAlternatives<NonAssignable, int>());
+
+    static_assert(std::is_trivially_copyable_v<Expected<void, int>>);
+    static_assert(!std::is_trivially_destructible_v<Expected<void, std::string>>);
+    static_assert(std::is_copy_assignable_v<Expected<void, std::string>>);
+    static_assert(!std::is_copy_constructible_v<Expected<void, std::unique_ptr<int>>>);
+    static_assert(std::is_nothrow_move_assignable_v<Expected<void, std::unique_ptr<int>>>);
+
+    TEST(SpecialMembers, TrivialCopyNonTrivialDestructor) {
+        Expected<TrivialCopyNonTrivialDestructor, int> Ex(std::in_place, TrivialCopyNonTrivialDestructor{42});
+        Expected<TrivialCopyNonTrivialDestructor, int> Copy = Ex;
+        ASSERT_EQ(Copy->Value, 42);
+
+        Copy = Expected<TrivialCopyNonTrivialDestructor, int>(unexpect, 7);
+        ASSERT_EQ(Copy.Error(), 7);
+        Copy = Ex;
+        ASSERT_EQ(Copy->Value, 42);
+    }
+
+    TEST(SpecialMembers, Void) {
+        Expected<void, std::string> Ex(unexpect, "oops");
+        Expected<void, std::string> Copy = Ex;
+        ASSERT_EQ(Copy.Error(), "oops");
+
+        Copy = Expected<void, std::string>();
+        ASSERT_TRUE(Copy.HasValue());
+        Copy = std::move(Ex);
+        ASSERT_EQ(Copy.Error(), "oops");
+    }
+}
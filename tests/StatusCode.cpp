@@ -0,0 +1,99 @@
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <gtest/gtest.h>
+
+#include <Expected/Expected.hpp>
+#include <Expected/StatusCode.hpp>
+
+namespace stdx::tests {
+    class CountingDomain final : public ErrorDomain {
+    public:
+        [[nodiscard]] std::string_view Name() const noexcept override {
+            return "counting";
+        }
+
+        [[nodiscard]] std::string Message(std::int64_t Code) const override {
+            ++Formatted;
+            return "code " + std::to_string(Code);
+        }
+
+        mutable int Formatted = 0;
+    };
+
+    static_assert(std::is_trivially_copyable_v<StatusCode>);
+    static_assert(sizeof(StatusCode) == sizeof(std::int64_t) + sizeof(void*));
+    static_assert(std::is_same_v<decltype(Unexpected(std::declval<StatusCode>())), Unexpected<StatusCode>>);
+    static_assert(IsRegisterPassable<Expected<int, StatusCode>>());
+    static_assert(IsRegisterPassable<Expected<void, StatusCode>>());
+    static_assert(sizeof(Expected<int, StatusCode>) == sizeof(StatusCode));
+    static_assert(sizeof(Expected<void, StatusCode>) == sizeof(StatusCode));
+
+    TEST(StatusCode, Equality) {
+        static const CountingDomain Domain;
+
+        StatusCode Code(42, Domain);
+        ASSERT_EQ(Code.Value(), 42);
+        ASSERT_EQ(&Code.Category(), &Domain);
+        ASSERT_EQ(Code, StatusCode(42, Domain));
+        ASSERT_NE(Code, StatusCode(43, Domain));
+        ASSERT_NE(StatusCode(42, GenericDomain()), Code);
+        ASSERT_EQ(StatusCode(std::errc::timed_out), StatusCode(std::int64_t(std::errc::timed_out), GenericDomain()));
+    }
+
+    TEST(StatusCode, Message) {
+        static const CountingDomain Domain;
+
+        Expected<int, StatusCode> Ex = Unexpected(StatusCode(7, Domain));
+        Expected<int, StatusCode> Copy = Ex;
+        ASSERT_EQ(Domain.Formatted, 0);
+        ASSERT_EQ(Copy.Error().Message(), "code 7");
+        ASSERT_EQ(Domain.Formatted, 1);
+
+        ASSERT_EQ(GenericDomain().Name(), "generic");
+        ASSERT_EQ(StatusCode(std::errc::timed_out).Message(), std::make_error_code(std::errc::timed_out).message());
+    }
+
+    TEST(StatusCode, Expected) {
+        static const CountingDomain Domain;
+
+        {
+            Expected<int, StatusCode> Ex = 42;
+            ASSERT_TRUE(Ex.HasValue());
+            ASSERT_EQ(*Ex, 42);
+            Ex = Unexpected(StatusCode(1, Domain));
+            ASSERT_FALSE(Ex.HasValue());
+            ASSERT_EQ(Ex.Error(), StatusCode(1, Domain));
+            Ex = 7;
+            ASSERT_TRUE(Ex.HasValue());
+            ASSERT_EQ(*Ex, 7);
+        }
+
+        {
+            Expected<void, StatusCode> Ex;
+            ASSERT_TRUE(Ex.HasValue());
+            Ex = Unexpected(StatusCode(std::errc::io_error));
+            ASSERT_FALSE(Ex.HasValue());
+            ASSERT_EQ(Ex.Error(), StatusCode(std::errc::io_error));
+        }
+
+        {
+            Expected<std::string, StatusCode> Ex(unexpect, 3, Domain);
+            ASSERT_FALSE(Ex.HasValue());
+            ASSERT_EQ(Ex.Error().Value(), 3);
+        }
+
+#if !defined(STDX_EXPECTED_NO_EXCEPTIONS)
+        {
+            Expected<int, StatusCode> Ex = Unexpected(StatusCode(5, Domain));
+            try {
+                static_cast<void>(Ex.Value());
+                FAIL();
+            } catch (const BadExpectedAccess<StatusCode>& Exception) {
+                ASSERT_EQ(Exception.Error(), StatusCode(5, Domain));
+            }
+        }
+#endif
+    }
+}
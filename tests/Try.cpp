@@ -0,0 +1,69 @@
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <Expected/Try.hpp>
+
+namespace stdx::tests {
+    Expected<int, std::string> ParseDigit(char Digit) {
+        if (Digit < '0' || Digit > '9') {
+            return Unexpected(std::string("not a digit: ") + Digit);
+        }
+        return Digit - '0';
+    }
+
+    Expected<void, const char*> Check(bool bOk) {
+        if (!bOk) {
+            return Unexpected("check failed");
+        }
+        return {};
+    }
+
+    Expected<int, std::string> ParsePair(const char* Text) {
+        STDX_EXPECTED_TRY_ASSIGN(const int Tens, ParseDigit(Text[0]));
+        STDX_EXPECTED_TRY_ASSIGN(const int Units, ParseDigit(Text[1]));
+        return Tens * 10 + Units;
+    }
+
+    // The error type of the caller only has to be constructible from that of the callee.
+    Expected<long, std::string> CheckedPair(const char* Text, bool bOk) {
+        STDX_EXPECTED_TRY(Check(bOk));
+        int Pair = 0;
+        STDX_EXPECTED_TRY_ASSIGN(Pair, ParsePair(Text));
+        return Pair;
+    }
+
+    TEST(Try, Propagates) {
+        ASSERT_EQ(ParsePair("42"), 42);
+        ASSERT_EQ(ParsePair("4x"), Unexpected(std::string("not a digit: x")));
+        ASSERT_EQ(ParsePair("x2"), Unexpected(std::string("not a digit: x")));
+
+        ASSERT_EQ(CheckedPair("42", true), 42L);
+        ASSERT_EQ(CheckedPair("42", false), Unexpected(std::string("check failed")));
+        ASSERT_EQ(CheckedPair("4?", true), Unexpected(std::string("not a digit: ?")));
+    }
+
+    TEST(Try, CopiesFromLvalues) {
+        const Expected<int, std::string> Failed = Unexpected(std::string("kept"));
+        const auto Forward = [&Failed]() -> Expected<int, std::string> {
+            STDX_EXPECTED_TRY(Failed);
+            return 0;
+        };
+        ASSERT_EQ(Forward(), Unexpected(std::string("kept")));
+        ASSERT_EQ(Failed.Error(), "kept");
+    }
+
+#if defined(STDX_EXPECTED_HAS_TRY_VALUE)
+    Expected<int, std::string> SumPair(const char* Text) {
+        STDX_EXPECTED_TRY_VALUE(Check(Text[0] != '\0'));
+        return STDX_EXPECTED_TRY_VALUE(ParseDigit(Text[0])) + STDX_EXPECTED_TRY_VALUE(ParseDigit(Text[1]));
+    }
+
+    TEST(Try, StatementExpression) {
+        ASSERT_EQ(SumPair("34"), 7);
+        ASSERT_EQ(SumPair("3!"), Unexpected(std::string("not a digit: !")));
+        ASSERT_EQ(SumPair(""), Unexpected(std::string("check failed")));
+    }
+#endif
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdlib>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -22,6 +23,14 @@ namespace stdx::tests {
     template <typename T, typename U>
     struct IsImplicitlyConstructible : decltype(IsImplicitlyConstructibleHelper<T>::__Dummy(std::declval<U>())) {};
 
+    [[noreturn]] inline void ThrowLogicError() {
+#if defined(STDX_EXPECTED_NO_EXCEPTIONS)
+        std::abort();
+#else
+        throw std::logic_error{"oops"};
+#endif
+    }
+
     struct NonDefaultConstructible {
         NonDefaultConstructible() = delete;
     };
@@ -31,7 +40,7 @@ namespace stdx::tests {
 
         ThrowableCopyConstructible(const ThrowableCopyConstructible& Other) : bThrow(Other.bThrow) {
             if (bThrow) {
-                throw std::logic_error{"oops"};
+                ThrowLogicError();
             } else {
                 Value = Other.Value;
             }
@@ -47,11 +56,11 @@ namespace stdx::tests {
         std::string Value;
     };
 
-    bool operator==(const ThrowableCopyConstructible& A, const ThrowableCopyConstructible& B) noexcept {
+    inline bool operator==(const ThrowableCopyConstructible& A, const ThrowableCopyConstructible& B) noexcept {
         return A.bThrow == B.bThrow && A.Value == B.Value;
     }
 
-    bool operator!=(const ThrowableCopyConstructible& A, const ThrowableCopyConstructible& B) noexcept {
+    inline bool operator!=(const ThrowableCopyConstructible& A, const ThrowableCopyConstructible& B) noexcept {
         return A.bThrow != B.bThrow || A.Value != B.Value;
     }
 
@@ -62,7 +71,7 @@ namespace stdx::tests {
 
         ThrowableMoveConstructible(ThrowableMoveConstructible&& Other) : bThrow(Other.bThrow) {
             if (bThrow) {
-                throw std::logic_error{"oops"};
+                ThrowLogicError();
             } else {
                 Value = std::move(Other.Value);
             }
@@ -76,18 +85,18 @@ namespace stdx::tests {
         std::string Value;
     };
 
-    bool operator==(const ThrowableMoveConstructible& A, const ThrowableMoveConstructible& B) noexcept {
+    inline bool operator==(const ThrowableMoveConstructible& A, const ThrowableMoveConstructible& B) noexcept {
         return A.bThrow == B.bThrow && A.Value == B.Value;
     }
 
-    bool operator!=(const ThrowableMoveConstructible& A, const ThrowableMoveConstructible& B) noexcept {
+    inline bool operator!=(const ThrowableMoveConstructible& A, const ThrowableMoveConstructible& B) noexcept {
         return A.bThrow != B.bThrow || A.Value != B.Value;
     }
 
     struct ThrowableEmplaceConstructible {
         ThrowableEmplaceConstructible(int X, double, const std::string&) {
             if (X == 42) {
-                throw std::logic_error{"oops"};
+                ThrowLogicError();
             }
         }
 
@@ -99,4 +108,30 @@ namespace stdx::tests {
 
         ThrowableEmplaceConstructible& operator=(ThrowableEmplaceConstructible&&) = default;
     };
+
+    struct Counted {
+        explicit Counted(int Value) noexcept : Value(Value) {}
+
+        Counted(const Counted& Other) noexcept : Value(Other.Value) {
+            ++Copies;
+        }
+
+        Counted(Counted&& Other) noexcept : Value(Other.Value) {
+            ++Moves;
+        }
+
+        Counted& operator=(const Counted&) = default;
+
+        Counted& operator=(Counted&&) = default;
+
+        static void Reset() noexcept {
+            Copies = 0;
+            Moves = 0;
+        }
+
+        int Value;
+
+        static inline int Copies = 0;
+        static inline int Moves = 0;
+    };
 }
\ No newline at end of file